@@ -106,6 +106,30 @@
 #   endif
 #endif
 
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+#   if defined(__cpp_constexpr) && __cpp_constexpr >= 201304L
+#       define BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
+#   endif
+#endif
+
+// For the lists of instrumented and registered enums, which can be pushed to
+// from any thread. Both are opt-in, so other programs don't include <atomic>.
+#if defined(BETTER_ENUMS_HAVE_CONSTEXPR) &&                                   \
+    (defined(BETTER_ENUMS_INSTRUMENT) || defined(BETTER_ENUMS_REGISTRY))
+#   include <atomic>
+#endif
+
+#ifndef BETTER_ENUMS_NO_STRING_VIEW
+#   if __cplusplus >= 201703L || \
+        (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#       define BETTER_ENUMS_HAVE_STRING_VIEW
+#   endif
+#endif
+
+#ifdef BETTER_ENUMS_HAVE_STRING_VIEW
+#   include <string_view>
+#endif
+
 // GCC (and maybe clang) can be made to warn about using 0 or NULL when nullptr
 // is available, so Better Enums tries to use nullptr. This passage uses
 // availability of constexpr as a proxy for availability of nullptr, i.e. it
@@ -122,18 +146,92 @@
 #   define BETTER_ENUMS_NULLPTR        NULL
 #endif
 
+// Functions that modify an object, such as enum_set::insert, can be constexpr
+// only with C++14 relaxed constexpr.
+#ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
+#   define BETTER_ENUMS_RELAXED_CONSTEXPR_     constexpr
+#else
+#   define BETTER_ENUMS_RELAXED_CONSTEXPR_
+#endif
+
 #ifndef BETTER_ENUMS_NO_EXCEPTIONS
 #   define BETTER_ENUMS_IF_EXCEPTIONS(x) x
 #else
 #   define BETTER_ENUMS_IF_EXCEPTIONS(x)
 #endif
 
+#ifdef BETTER_ENUMS_HAVE_STRING_VIEW
+#   define BETTER_ENUMS_IF_STRING_VIEW(x) x
+#else
+#   define BETTER_ENUMS_IF_STRING_VIEW(x)
+#endif
+
+// Wide names, Enum::_to_wstring and Enum::_from_wstring, are enabled by
+// defining BETTER_ENUMS_WIDE_NAMES. They require constexpr, because the table
+// of names in each character type is sized at compile time.
+#if defined(BETTER_ENUMS_WIDE_NAMES) && defined(BETTER_ENUMS_HAVE_CONSTEXPR)
+#   define BETTER_ENUMS_IF_WIDE_NAMES(x) x
+#else
+#   define BETTER_ENUMS_IF_WIDE_NAMES(x)
+#endif
+
 #ifdef __GNUC__
 #   define BETTER_ENUMS_UNUSED __attribute__((__unused__))
 #else
 #   define BETTER_ENUMS_UNUSED
 #endif
 
+#if defined(__GNUC__)
+#   define BETTER_ENUMS_NOINLINE __attribute__((__noinline__))
+#elif defined(_MSC_VER)
+#   define BETTER_ENUMS_NOINLINE __declspec(noinline)
+#else
+#   define BETTER_ENUMS_NOINLINE
+#endif
+
+#ifdef BETTER_ENUMS_COMPACT
+#   define BETTER_ENUMS_COMPACT_NOINLINE BETTER_ENUMS_NOINLINE
+#else
+#   define BETTER_ENUMS_COMPACT_NOINLINE
+#endif
+
+// Conversion instrumentation is enabled by defining BETTER_ENUMS_INSTRUMENT.
+// The conversion functions then pass the result of each lookup through
+// BETTER_ENUMS_INSTRUMENTED, which counts it. Otherwise, the macro expands to
+// the lookup alone. In C++11, counters are updated only when a conversion is
+// evaluated at run time, which is detected with
+// __builtin_is_constant_evaluated. Without that builtin, instrumented
+// conversions can't be evaluated at compile time.
+#ifdef BETTER_ENUMS_INSTRUMENT
+#   ifndef BETTER_ENUMS_INSTRUMENT_SHARDS
+#       define BETTER_ENUMS_INSTRUMENT_SHARDS 8
+#   endif
+#   define BETTER_ENUMS_INSTRUMENTED(Enum, counter, index)                     \
+        ::better_enums::_instrument<Enum>(::better_enums::counter, index)
+#else
+#   define BETTER_ENUMS_INSTRUMENTED(Enum, counter, index) index
+#endif
+
+#ifdef __has_builtin
+#   if __has_builtin(__builtin_is_constant_evaluated)
+#       define BETTER_ENUMS_HAVE_IS_CONSTANT_EVALUATED
+#   endif
+#endif
+
+#ifndef BETTER_ENUMS_HAVE_IS_CONSTANT_EVALUATED
+#   if (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) || \
+        (defined(_MSC_VER) && _MSC_VER >= 1925)
+#       define BETTER_ENUMS_HAVE_IS_CONSTANT_EVALUATED
+#   endif
+#endif
+
+#ifdef BETTER_ENUMS_HAVE_IS_CONSTANT_EVALUATED
+#   define BETTER_ENUMS_IS_CONSTANT_EVALUATED()                               \
+        __builtin_is_constant_evaluated()
+#else
+#   define BETTER_ENUMS_IS_CONSTANT_EVALUATED() false
+#endif
+
 
 
 // Higher-order preprocessor macros.
@@ -447,870 +545,4136 @@ struct _iterable {
 
 
 
-// String routines.
+// Type selection helpers.
 
-BETTER_ENUMS_CONSTEXPR_ static const char       *_name_enders = "= \t\n";
+template <bool Condition, typename Then, typename Else>
+struct _select_type { typedef Then type; };
 
-BETTER_ENUMS_CONSTEXPR_ inline bool _ends_name(char c, std::size_t index = 0)
+template <typename Then, typename Else>
+struct _select_type<false, Then, Else> { typedef Else type; };
+
+// Smallest unsigned type that can hold every index into an enum with Count
+// constants, and also Count itself, which is used as a "no index" sentinel.
+template <std::size_t Count>
+struct _compact_index {
+    typedef typename _select_type<(Count < 0xff), unsigned char,
+            typename _select_type<(Count < 0xffff), unsigned short,
+                                  std::size_t>::type>::type   type;
+};
+
+
+
+// Access to the internal tables of a Better Enum, for the lookup templates in
+// this namespace. The tables themselves are generated into a separate namespace
+// for each enum, so they can't be named here directly.
+
+template <typename Enum>
+struct _access {
+    BETTER_ENUMS_CONSTEXPR_ static const char * const * raw_names()
+        { return Enum::_raw_names(); }
+
+    BETTER_ENUMS_CONSTEXPR_ static const char* raw_name(std::size_t index)
+        { return Enum::_raw_name(index); }
+
+    template <typename Result, typename Visitor>
+    static Result visit(std::size_t index, Visitor &visitor)
+        { return Enum::template _visit<Result>(index, visitor); }
+
+    // The name of value and its length, found with a single value lookup, or
+    // a null pointer and zero if value is not one of the constants.
+    static const char* name(const Enum &value, std::size_t &length)
+    {
+        Enum::initialize();
+
+        typename Enum::_optional_index  index = Enum::_from_value(value._value);
+
+        length = Enum::_length_or_zero(index);
+        return Enum::_name_or_null(index);
+    }
+
+    // The name of the constant at index, or a null pointer if there is none.
+    static const char* name_at(optional<std::size_t> index)
+    {
+        Enum::initialize();
+        return Enum::_name_or_null(index);
+    }
+};
+
+
+
+// Value lookup. Finding the index of a value is the first step of _to_string,
+// _to_index, _from_integral, and _is_valid. When the compiler supports
+// constexpr, each Better Enum picks one of these strategies at compile time,
+// based on the declared values. Otherwise, the linear scan is always used. The
+// choice can be queried with Enum::_value_lookup_strategy(). Names are looked
+// up either by linear scan or, optionally, by hashing; see "Name lookup" below.
+
+enum lookup_strategy {
+    // Compare the value with each declared constant in turn.
+    linear_scan,
+    // The constants are consecutive integers in declaration order, so the index
+    // is the distance from the first constant.
+    offset_lookup,
+    // The constants fall into a range at most twice the number of constants
+    // wide. The index is taken from a table with one entry per integer in the
+    // range.
+    table_lookup,
+    // Names only. The name is hashed, and compared only with the constants
+    // whose names have the same hash.
+    hash_lookup
+};
+
+#if !defined(BETTER_ENUMS_HAVE_CONSTEXPR) || \
+    defined(BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR)
+
+// When the scan can be written as a loop, it compares the value with a block of
+// constants at a time, as many as fit in 16 bytes, and combines the results
+// without branching. Compilers turn each block into a few vector instructions
+// (SSE2, NEON), so even a sparse enum with dozens of constants is checked in a
+// handful of steps. The constants that don't fill a whole block are compared
+// one by one.
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_value_scan(typename Enum::_integral value)
 {
-    return
-        c == _name_enders[index] ? true  :
-        _name_enders[index] == '\0' ? false :
-        _ends_name(c, index + 1);
+    typedef typename Enum::_integral    integral;
+
+    const std::size_t   lanes =
+        sizeof(integral) < 16 ? 16 / sizeof(integral) : 1;
+    const std::size_t   blocks_end =
+        Enum::_size_constant - Enum::_size_constant % lanes;
+
+    for (std::size_t base = 0; base < blocks_end; base += lanes) {
+        unsigned        matches = 0;
+
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            matches +=
+                Enum::_values()[base + lane]._to_integral() == value ? 1u : 0u;
+        }
+
+        if (matches != 0) {
+            std::size_t first = base;
+
+            while (Enum::_values()[first]._to_integral() != value)
+                ++first;
+
+            return optional<std::size_t>(first);
+        }
+    }
+
+    for (std::size_t index = blocks_end; index < Enum::_size_constant;
+         ++index) {
+
+        if (Enum::_values()[index]._to_integral() == value)
+            return optional<std::size_t>(index);
+    }
+
+    return optional<std::size_t>();
 }
 
-BETTER_ENUMS_CONSTEXPR_ inline bool _has_initializer(const char *s,
-                                                     std::size_t index = 0)
+#else
+
+template <typename Enum>
+constexpr optional<std::size_t>
+_value_scan(typename Enum::_integral value, std::size_t index = 0)
 {
     return
-        s[index] == '\0' ? false :
-        s[index] == '=' ? true :
-        _has_initializer(s, index + 1);
+        index == Enum::_size() ? optional<std::size_t>() :
+        Enum::_values()[index]._to_integral() == value ?
+            optional<std::size_t>(index) :
+            _value_scan<Enum>(value, index + 1);
 }
 
-BETTER_ENUMS_CONSTEXPR_ inline std::size_t
-_constant_length(const char *s, std::size_t index = 0)
+#endif
+
+template <typename Enum, lookup_strategy Strategy>
+struct _value_index {
+    BETTER_ENUMS_CONSTEXPR_ static optional<std::size_t>
+    find(typename Enum::_integral value) { return _value_scan<Enum>(value); }
+};
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+// Compile-time integer sequences, generated with logarithmic template depth.
+
+template <std::size_t... Indices>
+struct _index_sequence { typedef _index_sequence type; };
+
+template <typename First, typename Second>
+struct _concat_sequences;
+
+template <std::size_t... First, std::size_t... Second>
+struct _concat_sequences<_index_sequence<First...>,
+                         _index_sequence<Second...> > :
+    _index_sequence<First..., (sizeof...(First) + Second)...> { };
+
+template <std::size_t Length>
+struct _make_index_sequence :
+    _concat_sequences<typename _make_index_sequence<Length / 2>::type,
+                      typename _make_index_sequence<Length - Length / 2>::type>
+    { };
+
+template <>
+struct _make_index_sequence<0> : _index_sequence<> { };
+
+template <>
+struct _make_index_sequence<1> : _index_sequence<0> { };
+
+
+
+// Distances between values are computed in the widest unsigned type, where
+// wrap-around is well-defined, so that they don't overflow even for constants
+// at opposite ends of the underlying type's range.
+typedef unsigned long long _wide_unsigned;
+
+template <typename Integral>
+constexpr _wide_unsigned _value_distance(Integral from, Integral to)
 {
-    return _ends_name(s[index]) ? index : _constant_length(s, index + 1);
+    return static_cast<_wide_unsigned>(to) - static_cast<_wide_unsigned>(from);
 }
 
-BETTER_ENUMS_CONSTEXPR_ inline char
-_select(const char *from, std::size_t from_length, std::size_t index)
+template <typename Integral>
+constexpr Integral _lesser(Integral a, Integral b) { return b < a ? b : a; }
+
+template <typename Integral>
+constexpr Integral _greater(Integral a, Integral b) { return a < b ? b : a; }
+
+template <typename Enum>
+constexpr typename Enum::_integral _value_at(std::size_t index)
 {
-    return index >= from_length ? '\0' : from[index];
+    return Enum::_values()[index]._to_integral();
 }
 
-BETTER_ENUMS_CONSTEXPR_ inline char _to_lower_ascii(char c)
+// The traits of the declared values are computed by splitting the constants in
+// halves, rather than by walking them one at a time, so that the depth of
+// constexpr recursion grows only with the logarithm of the number of constants.
+// Each function takes a range of count >= 1 constants, starting at first.
+
+template <typename Enum>
+constexpr typename Enum::_integral
+_min_value_in(std::size_t first, std::size_t count)
 {
-    return c >= 0x41 && c <= 0x5A ? static_cast<char>(c + 0x20) : c;
+    return
+        count == 1 ? _value_at<Enum>(first) :
+        _lesser(_min_value_in<Enum>(first, count / 2),
+                _min_value_in<Enum>(first + count / 2, count - count / 2));
 }
 
-BETTER_ENUMS_CONSTEXPR_ inline bool _names_match(const char *stringizedName,
-                                                 const char *referenceName,
-                                                 std::size_t index = 0)
+template <typename Enum>
+constexpr typename Enum::_integral
+_max_value_in(std::size_t first, std::size_t count)
 {
     return
-        _ends_name(stringizedName[index]) ? referenceName[index] == '\0' :
-        referenceName[index] == '\0' ? false :
-        stringizedName[index] != referenceName[index] ? false :
-        _names_match(stringizedName, referenceName, index + 1);
+        count == 1 ? _value_at<Enum>(first) :
+        _greater(_max_value_in<Enum>(first, count / 2),
+                 _max_value_in<Enum>(first + count / 2, count - count / 2));
 }
 
-BETTER_ENUMS_CONSTEXPR_ inline bool
-_names_match_nocase(const char *stringizedName, const char *referenceName,
-                    std::size_t index = 0)
+// Whether each constant in the range is as far from the first constant as its
+// index.
+template <typename Enum>
+constexpr bool _values_consecutive_in(std::size_t first, std::size_t count)
 {
     return
-        _ends_name(stringizedName[index]) ? referenceName[index] == '\0' :
-        referenceName[index] == '\0' ? false :
-        _to_lower_ascii(stringizedName[index]) !=
-            _to_lower_ascii(referenceName[index]) ? false :
-        _names_match_nocase(stringizedName, referenceName, index + 1);
+        count == 1 ?
+            _value_distance(_value_at<Enum>(0), _value_at<Enum>(first)) ==
+                first :
+        _values_consecutive_in<Enum>(first, count / 2) &&
+        _values_consecutive_in<Enum>(first + count / 2, count - count / 2);
 }
 
-inline void _trim_names(const char * const *raw_names,
-                        const char **trimmed_names,
-                        char *storage, std::size_t count)
+// Whether no constant in the range is less than the one before it. The halves
+// overlap by one constant, so that the pair straddling them is compared.
+template <typename Enum>
+constexpr bool _values_sorted_in(std::size_t first, std::size_t count)
 {
-    std::size_t     offset = 0;
+    return
+        count == 1 ? true :
+        count == 2 ? !(_value_at<Enum>(first + 1) < _value_at<Enum>(first)) :
+        _values_sorted_in<Enum>(first, count / 2 + 1) &&
+        _values_sorted_in<Enum>(first + count / 2, count - count / 2);
+}
 
-    for (std::size_t index = 0; index < count; ++index) {
-        trimmed_names[index] = storage + offset;
+// The traits of the declared values, computed once per enum, for the lookup
+// strategies and for the Enum::_min_value() family.
+template <typename Enum>
+struct _value_range {
+    typedef typename Enum::_integral    integral;
+
+    static constexpr integral           min =
+        _min_value_in<Enum>(0, Enum::_size_constant);
+    static constexpr integral           max =
+        _max_value_in<Enum>(0, Enum::_size_constant);
+    static constexpr _wide_unsigned     span = _value_distance(min, max);
+    static constexpr bool               consecutive =
+        _values_consecutive_in<Enum>(0, Enum::_size_constant);
+    static constexpr bool               sorted =
+        _values_sorted_in<Enum>(0, Enum::_size_constant);
+};
 
-        std::size_t trimmed_length =
-            std::strcspn(raw_names[index], _name_enders);
-        storage[offset + trimmed_length] = '\0';
+template <typename Enum>
+constexpr typename Enum::_integral  _value_range<Enum>::min;
+template <typename Enum>
+constexpr typename Enum::_integral  _value_range<Enum>::max;
+template <typename Enum>
+constexpr _wide_unsigned            _value_range<Enum>::span;
+template <typename Enum>
+constexpr bool                      _value_range<Enum>::consecutive;
+template <typename Enum>
+constexpr bool                      _value_range<Enum>::sorted;
 
-        std::size_t raw_length = std::strlen(raw_names[index]);
-        offset += raw_length + 1;
-    }
+template <typename Enum>
+constexpr lookup_strategy _select_value_lookup()
+{
+    return
+        _value_range<Enum>::consecutive ? offset_lookup :
+        _value_range<Enum>::span < 2 * Enum::_size() ? table_lookup :
+        linear_scan;
 }
 
+template <typename Enum>
+struct _value_index<Enum, offset_lookup> {
+    constexpr static optional<std::size_t>
+    find(typename Enum::_integral value)
+    {
+        return
+            at(_value_distance(Enum::_values()[0]._to_integral(), value));
+    }
 
+  private:
+    constexpr static optional<std::size_t> at(_wide_unsigned offset)
+    {
+        return
+            offset < Enum::_size() ?
+                optional<std::size_t>(static_cast<std::size_t>(offset)) :
+                optional<std::size_t>();
+    }
+};
 
-// Eager initialization.
+// Index of the constant with value base + offset, or the size of the enum if
+// there is no such constant.
 template <typename Enum>
-struct _initialize_at_program_start {
-    _initialize_at_program_start() { Enum::initialize(); }
-};
+constexpr std::size_t _dense_entry(typename Enum::_integral base,
+                                   std::size_t offset)
+{
+    return
+        _value_scan<Enum>(static_cast<typename Enum::_integral>(
+            static_cast<_wide_unsigned>(base) + offset)) ?
+        *_value_scan<Enum>(static_cast<typename Enum::_integral>(
+            static_cast<_wide_unsigned>(base) + offset)) :
+        Enum::_size();
+}
 
-} // namespace better_enums
+template <typename Enum, typename Offsets>
+struct _dense_table;
 
+template <typename Enum, std::size_t... Offsets>
+struct _dense_table<Enum, _index_sequence<Offsets...> > {
+    typedef typename _compact_index<Enum::_size_constant>::type     entry;
 
+    static constexpr typename Enum::_integral   base =
+        _value_range<Enum>::min;
+    static constexpr entry                      entries[] =
+        { static_cast<entry>(_dense_entry<Enum>(base, Offsets))... };
+};
 
-// Array generation macros.
+template <typename Enum, std::size_t... Offsets>
+constexpr typename _dense_table<Enum, _index_sequence<Offsets...> >::entry
+_dense_table<Enum, _index_sequence<Offsets...> >::entries[];
 
-#define BETTER_ENUMS_EAT_ASSIGN_SINGLE(EnumType, index, expression)            \
-    (EnumType)((::better_enums::_eat_assign<EnumType>)EnumType::expression),
+template <typename Enum>
+struct _value_index<Enum, table_lookup> {
+    constexpr static optional<std::size_t>
+    find(typename Enum::_integral value)
+    {
+        return at(_value_distance(table::base, value));
+    }
 
-#define BETTER_ENUMS_EAT_ASSIGN(EnumType, ...)                                 \
-    BETTER_ENUMS_ID(                                                           \
-        BETTER_ENUMS_PP_MAP(                                                   \
-            BETTER_ENUMS_EAT_ASSIGN_SINGLE, EnumType, __VA_ARGS__))
+  private:
+    static constexpr std::size_t    range =
+        static_cast<std::size_t>(_value_range<Enum>::span) + 1;
 
+    typedef _dense_table<Enum, typename _make_index_sequence<range>::type>
+                                    table;
 
+    constexpr static optional<std::size_t> at(_wide_unsigned offset)
+    {
+        return
+            offset < range ?
+                entry(table::entries[static_cast<std::size_t>(offset)]) :
+                optional<std::size_t>();
+    }
 
-#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+    constexpr static optional<std::size_t> entry(std::size_t index)
+    {
+        return
+            index < Enum::_size() ?
+                optional<std::size_t>(index) : optional<std::size_t>();
+    }
 
+  public:
+    // Whether every entry of the table is a constant.
+    constexpr static bool complete()
+    {
+        return _entries_valid(table::entries, 0, range);
+    }
 
+  private:
+    template <typename Entry>
+    constexpr static bool
+    _entries_valid(const Entry *entries, std::size_t first, std::size_t count)
+    {
+        return
+            count == 1 ? entries[first] < Enum::_size() :
+            _entries_valid(entries, first, count / 2) &&
+            _entries_valid(entries, first + count / 2, count - count / 2);
+    }
+};
 
-#define BETTER_ENUMS_SELECT_SINGLE_CHARACTER(from, from_length, index)         \
-    ::better_enums::_select(from, from_length, index),
+// Whether the declared values, taken as a set, leave no gaps between the least
+// and the greatest. Consecutive values leave none. Values too sparse for a
+// table leave at least one, as there are fewer constants than integers in their
+// span. Only a table has to be checked, and it is the one the lookup uses.
+template <typename Enum,
+          lookup_strategy Strategy = _select_value_lookup<Enum>()>
+struct _value_contiguity {
+    constexpr static bool get() { return Strategy == offset_lookup; }
+};
 
-#define BETTER_ENUMS_SELECT_CHARACTERS(from, from_length)                      \
-    BETTER_ENUMS_ITERATE(                                                      \
-        BETTER_ENUMS_SELECT_SINGLE_CHARACTER, from, from_length)
+template <typename Enum>
+struct _value_contiguity<Enum, table_lookup> {
+    constexpr static bool get()
+        { return _value_index<Enum, table_lookup>::complete(); }
+};
 
+template <typename Enum>
+constexpr typename Enum::_integral _min_integral()
+{
+    return _value_range<Enum>::min;
+}
 
+template <typename Enum>
+constexpr typename Enum::_integral _max_integral()
+{
+    return _value_range<Enum>::max;
+}
 
-#define BETTER_ENUMS_TRIM_SINGLE_STRING(ignored, index, expression)            \
-constexpr std::size_t   _length_ ## index =                                    \
-    ::better_enums::_constant_length(#expression);                             \
-constexpr const char    _trimmed_ ## index [] =                                \
-    { BETTER_ENUMS_SELECT_CHARACTERS(#expression, _length_ ## index) };        \
-constexpr const char    *_final_ ## index =                                    \
-    ::better_enums::_has_initializer(#expression) ?                            \
-        _trimmed_ ## index : #expression;
+template <typename Enum>
+constexpr bool _values_sorted() { return _value_range<Enum>::sorted; }
 
-#define BETTER_ENUMS_TRIM_STRINGS(...)                                         \
-    BETTER_ENUMS_ID(                                                           \
-        BETTER_ENUMS_PP_MAP(                                                   \
-            BETTER_ENUMS_TRIM_SINGLE_STRING, ignored, __VA_ARGS__))
+template <typename Enum>
+constexpr bool _values_contiguous() { return _value_contiguity<Enum>::get(); }
 
+template <typename Enum>
+constexpr double _values_density()
+{
+    return
+        static_cast<double>(Enum::_size_constant) /
+        (static_cast<double>(_value_range<Enum>::span) + 1);
+}
 
+#else
 
-#define BETTER_ENUMS_REFER_TO_SINGLE_STRING(ignored, index, expression)        \
-    _final_ ## index,
+// Without constexpr, the traits of the declared values are computed on each
+// call.
 
-#define BETTER_ENUMS_REFER_TO_STRINGS(...)                                     \
-    BETTER_ENUMS_ID(                                                           \
-        BETTER_ENUMS_PP_MAP(                                                   \
-            BETTER_ENUMS_REFER_TO_SINGLE_STRING, ignored, __VA_ARGS__))
+template <typename Enum>
+inline typename Enum::_integral _min_integral()
+{
+    typename Enum::_integral    result = Enum::_values()[0]._to_integral();
 
+    for (std::size_t index = 1; index < Enum::_size_constant; ++index) {
+        if (Enum::_values()[index]._to_integral() < result)
+            result = Enum::_values()[index]._to_integral();
+    }
 
+    return result;
+}
 
-#endif // #ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+template <typename Enum>
+inline typename Enum::_integral _max_integral()
+{
+    typename Enum::_integral    result = Enum::_values()[0]._to_integral();
 
+    for (std::size_t index = 1; index < Enum::_size_constant; ++index) {
+        if (result < Enum::_values()[index]._to_integral())
+            result = Enum::_values()[index]._to_integral();
+    }
 
+    return result;
+}
 
-#define BETTER_ENUMS_STRINGIZE_SINGLE(ignored, index, expression)  #expression,
+template <typename Enum>
+inline unsigned long _value_span()
+{
+    return
+        static_cast<unsigned long>(_max_integral<Enum>()) -
+        static_cast<unsigned long>(_min_integral<Enum>());
+}
 
-#define BETTER_ENUMS_STRINGIZE(...)                                            \
-    BETTER_ENUMS_ID(                                                           \
-        BETTER_ENUMS_PP_MAP(                                                   \
-            BETTER_ENUMS_STRINGIZE_SINGLE, ignored, __VA_ARGS__))
+template <typename Enum>
+inline bool _values_sorted()
+{
+    for (std::size_t index = 1; index < Enum::_size_constant; ++index) {
+        if (Enum::_values()[index]._to_integral() <
+            Enum::_values()[index - 1]._to_integral()) {
 
-#define BETTER_ENUMS_RESERVE_STORAGE_SINGLE(ignored, index, expression)        \
-    #expression ","
+            return false;
+        }
+    }
 
-#define BETTER_ENUMS_RESERVE_STORAGE(...)                                      \
-    BETTER_ENUMS_ID(                                                           \
-        BETTER_ENUMS_PP_MAP(                                                   \
-            BETTER_ENUMS_RESERVE_STORAGE_SINGLE, ignored, __VA_ARGS__))
+    return true;
+}
 
+template <typename Enum>
+inline bool _values_contiguous()
+{
+    typedef typename Enum::_integral    integral;
 
+    unsigned long   span = _value_span<Enum>();
+    unsigned long   base = static_cast<unsigned long>(_min_integral<Enum>());
 
-// The enums proper.
+    if (span >= Enum::_size_constant)
+        return false;
 
-#define BETTER_ENUMS_NS(EnumType)  better_enums_data_ ## EnumType
+    for (unsigned long offset = 1; offset < span; ++offset) {
+        if (!_value_scan<Enum>(static_cast<integral>(base + offset)))
+            return false;
+    }
 
-#ifdef BETTER_ENUMS_VC2008_WORKAROUNDS
+    return true;
+}
 
-#define BETTER_ENUMS_COPY_CONSTRUCTOR(Enum)                                    \
-        BETTER_ENUMS_CONSTEXPR_ Enum(const Enum &other) :                      \
-            _value(other._value) { }
+template <typename Enum>
+inline double _values_density()
+{
+    return
+        static_cast<double>(Enum::_size_constant) /
+        (static_cast<double>(_value_span<Enum>()) + 1);
+}
+
+#endif // #ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+// Value lookup for the bulk conversions, such as better_enums::from_integral_n,
+// which convert a whole array at once. The constant-time strategies are used as
+// they are. Instead of a linear scan, the declared values are sorted once, the
+// first time any bulk conversion needs them, and each element is then found by
+// binary search.
+
+template <typename Enum>
+class _sorted_values {
+  public:
+    typedef typename Enum::_integral                                integral;
+    typedef typename _compact_index<Enum::_size_constant>::type     index_type;
+
+    static const _sorted_values& instance()
+    {
+        static const _sorted_values     sorted;
+        return sorted;
+    }
+
+    optional<std::size_t> find(integral value) const
+    {
+        std::size_t     low = 0;
+        std::size_t     high = Enum::_size_constant;
+
+        while (low < high) {
+            std::size_t middle = low + (high - low) / 2;
+
+            if (_values[middle] < value)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        return
+            low < Enum::_size_constant && _values[low] == value ?
+                optional<std::size_t>(_indices[low]) :
+                optional<std::size_t>();
+    }
+
+  private:
+    // Insertion sort. It is stable, so, of several constants with the same
+    // value, the first declared is found, just as it would be by a scan.
+    _sorted_values() : _values(), _indices()
+    {
+        for (std::size_t index = 0; index < Enum::_size_constant; ++index) {
+            integral        value = Enum::_values()[index]._to_integral();
+            std::size_t     slot = index;
+
+            for (; slot > 0 && value < _values[slot - 1]; --slot) {
+                _values[slot] = _values[slot - 1];
+                _indices[slot] = _indices[slot - 1];
+            }
+
+            _values[slot] = value;
+            _indices[slot] = static_cast<index_type>(index);
+        }
+    }
+
+    integral        _values[Enum::_size_constant];
+    index_type      _indices[Enum::_size_constant];
+};
+
+template <typename Enum, lookup_strategy Strategy>
+struct _value_batch {
+    optional<std::size_t> find(typename Enum::_integral value) const
+        { return _value_index<Enum, Strategy>::find(value); }
+};
+
+template <typename Enum>
+struct _value_batch<Enum, linear_scan> {
+    _value_batch() : _sorted(_sorted_values<Enum>::instance()) { }
+
+    optional<std::size_t> find(typename Enum::_integral value) const
+        { return _sorted.find(value); }
+
+  private:
+    const _sorted_values<Enum>  &_sorted;
+};
+
+
+
+// String routines.
+
+BETTER_ENUMS_CONSTEXPR_ static const char       *_name_enders = "= \t\n";
+
+BETTER_ENUMS_CONSTEXPR_ inline bool _ends_name(char c, std::size_t index = 0)
+{
+    return
+        c == _name_enders[index] ? true  :
+        _name_enders[index] == '\0' ? false :
+        _ends_name(c, index + 1);
+}
+
+BETTER_ENUMS_CONSTEXPR_ inline bool _has_initializer(const char *s,
+                                                     std::size_t index = 0)
+{
+    return
+        s[index] == '\0' ? false :
+        s[index] == '=' ? true :
+        _has_initializer(s, index + 1);
+}
+
+BETTER_ENUMS_CONSTEXPR_ inline std::size_t
+_constant_length(const char *s, std::size_t index = 0)
+{
+    return _ends_name(s[index]) ? index : _constant_length(s, index + 1);
+}
+
+BETTER_ENUMS_CONSTEXPR_ inline char
+_select(const char *from, std::size_t from_length, std::size_t index)
+{
+    return index >= from_length ? '\0' : from[index];
+}
+
+BETTER_ENUMS_CONSTEXPR_ inline char _to_lower_ascii(char c)
+{
+    return c >= 0x41 && c <= 0x5A ? static_cast<char>(c + 0x20) : c;
+}
+
+BETTER_ENUMS_CONSTEXPR_ inline bool _names_match(const char *stringizedName,
+                                                 const char *referenceName,
+                                                 std::size_t index = 0)
+{
+    return
+        _ends_name(stringizedName[index]) ? referenceName[index] == '\0' :
+        referenceName[index] == '\0' ? false :
+        stringizedName[index] != referenceName[index] ? false :
+        _names_match(stringizedName, referenceName, index + 1);
+}
+
+BETTER_ENUMS_CONSTEXPR_ inline bool
+_names_match_nocase(const char *stringizedName, const char *referenceName,
+                    std::size_t index = 0)
+{
+    return
+        _ends_name(stringizedName[index]) ? referenceName[index] == '\0' :
+        referenceName[index] == '\0' ? false :
+        _to_lower_ascii(stringizedName[index]) !=
+            _to_lower_ascii(referenceName[index]) ? false :
+        _names_match_nocase(stringizedName, referenceName, index + 1);
+}
+
+BETTER_ENUMS_CONSTEXPR_ inline bool
+_names_match_length(const char *stringizedName, const char *referenceName,
+                    std::size_t length, std::size_t index = 0)
+{
+    return
+        index == length ? _ends_name(stringizedName[index]) :
+        _ends_name(stringizedName[index]) ? false :
+        stringizedName[index] != referenceName[index] ? false :
+        _names_match_length(stringizedName, referenceName, length, index + 1);
+}
+
+BETTER_ENUMS_CONSTEXPR_ inline bool
+_names_match_length_nocase(const char *stringizedName,
+                           const char *referenceName, std::size_t length,
+                           std::size_t index = 0)
+{
+    return
+        index == length ? _ends_name(stringizedName[index]) :
+        _ends_name(stringizedName[index]) ? false :
+        _to_lower_ascii(stringizedName[index]) !=
+            _to_lower_ascii(referenceName[index]) ? false :
+        _names_match_length_nocase(stringizedName, referenceName, length,
+                                   index + 1);
+}
+
+// Length of a null-terminated string, but at most limit.
+BETTER_ENUMS_CONSTEXPR_ inline std::size_t
+_string_length(const char *s, std::size_t limit, std::size_t index = 0)
+{
+    return
+        index == limit || s[index] == '\0' ? index :
+        _string_length(s, limit, index + 1);
+}
+
+#ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
+
+// Names trimmed at compile time, using C++14 relaxed constexpr. The names are
+// copied one after another into a single array of characters, each followed by
+// a null character, so that the array can be placed in read-only memory. Each
+// name is found by its offset into the array, and the offsets are the smallest
+// unsigned integers that can index it. The offset one past the last name is
+// also stored, so that the length of each name is the difference between
+// consecutive offsets, less one for the null character. Lookups index the
+// offsets directly. An array of pointers to the names is instantiated only for
+// the functions that return the names as an array, such as _names().
+
+constexpr std::size_t _trimmed_size(const char * const *raw_names,
+                                    std::size_t count)
+{
+    std::size_t     size = 0;
+
+    for (std::size_t index = 0; index < count; ++index)
+        size += _constant_length(raw_names[index]) + 1;
+
+    return size;
+}
+
+template <std::size_t Count>
+struct _name_pointers {
+    const char      *pointers[Count];
+};
+
+template <std::size_t Size, std::size_t Count>
+struct _trimmed_names {
+    typedef typename _compact_index<Size>::type     offset_type;
+
+    char            storage[Size];
+    offset_type     offsets[Count + 1];
+
+    constexpr const char* name(std::size_t index) const
+    {
+        return storage + offsets[index];
+    }
+
+    constexpr std::size_t length(std::size_t index) const
+    {
+        return
+            static_cast<std::size_t>(offsets[index + 1] - offsets[index]) - 1;
+    }
+
+    static constexpr _trimmed_names trim(const char * const *raw_names)
+    {
+        _trimmed_names  result = {};
+        std::size_t     offset = 0;
+
+        for (std::size_t index = 0; index < Count; ++index) {
+            result.offsets[index] = static_cast<offset_type>(offset);
+
+            for (const char *c = raw_names[index]; !_ends_name(*c); ++c)
+                result.storage[offset++] = *c;
+
+            result.storage[offset++] = '\0';
+        }
+
+        result.offsets[Count] = static_cast<offset_type>(offset);
+
+        return result;
+    }
+
+    // Must be called on an object with static storage duration, so that the
+    // resulting pointers are constant expressions.
+    static constexpr _name_pointers<Count> refer(const _trimmed_names &names)
+    {
+        _name_pointers<Count>   result = {};
+
+        for (std::size_t index = 0; index < Count; ++index)
+            result.pointers[index] = names.name(index);
+
+        return result;
+    }
+};
+
+#endif // #ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
+
+BETTER_ENUMS_COMPACT_NOINLINE
+inline void _trim_names(const char * const *raw_names,
+                        const char **trimmed_names,
+                        std::size_t *trimmed_lengths,
+                        char *storage, std::size_t count)
+{
+    std::size_t     offset = 0;
+
+    for (std::size_t index = 0; index < count; ++index) {
+        trimmed_names[index] = storage + offset;
+
+        std::size_t trimmed_length =
+            std::strcspn(raw_names[index], _name_enders);
+        storage[offset + trimmed_length] = '\0';
+        trimmed_lengths[index] = trimmed_length;
+
+        std::size_t raw_length = std::strlen(raw_names[index]);
+        offset += raw_length + 1;
+    }
+}
+
+
+
+// Name lookup. By default, a name is compared with each declared constant in
+// turn. If BETTER_ENUMS_HASH_NAMES is defined and the compiler supports
+// constexpr, a hash table over the names of each enum is built at compile time
+// instead. The choice can be queried with Enum::_name_lookup_strategy().
+//
+// Names are looked up either as null-terminated strings, or as a pointer and a
+// length, which need not be followed by a null character. In the latter case,
+// with hashed lookup, the lengths of all names are also computed at compile
+// time, and a constant is skipped without comparing any characters if its name
+// has a different length. The same table gives the name lengths of
+// full-constexpr enums. Other enums record the lengths when their names are
+// trimmed at run time, so the table is only built for enums that use it.
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+template <typename Enum, typename Indices>
+struct _name_length_table;
+
+template <typename Enum, std::size_t... Indices>
+struct _name_length_table<Enum, _index_sequence<Indices...> > {
+    static constexpr std::size_t    lengths[] =
+        { _constant_length(_access<Enum>::raw_name(Indices))... };
+};
+
+template <typename Enum, std::size_t... Indices>
+constexpr std::size_t
+_name_length_table<Enum, _index_sequence<Indices...> >::lengths[];
+
+template <typename Enum>
+constexpr std::size_t _name_length(std::size_t index)
+{
+    return
+        _name_length_table<
+            Enum, typename _make_index_sequence<Enum::_size_constant>::type>::
+                lengths[index];
+}
+
+template <typename Enum>
+constexpr std::size_t
+_longest_name_loop(std::size_t accumulator, std::size_t index)
+{
+    return
+        index >= Enum::_size() ? accumulator :
+        _name_length<Enum>(index) > accumulator ?
+            _longest_name_loop<Enum>(_name_length<Enum>(index), index + 1) :
+            _longest_name_loop<Enum>(accumulator, index + 1);
+}
+
+template <typename Enum>
+constexpr std::size_t _longest_name()
+{
+    return _longest_name_loop<Enum>(0, 0);
+}
+
+#endif // #ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+#if defined(BETTER_ENUMS_HAVE_CONSTEXPR) && defined(BETTER_ENUMS_HASH_NAMES)
+
+template <typename Enum>
+constexpr bool _name_has_length(std::size_t index, std::size_t length)
+{
+    return _name_length<Enum>(index) == length;
+}
 
 #else
 
-#define BETTER_ENUMS_COPY_CONSTRUCTOR(Enum)
+// Without hashed lookup, the table of lengths is not built. The comparison
+// itself rejects a name of the wrong length as soon as either string ends.
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline bool _name_has_length(std::size_t, std::size_t)
+{
+    return true;
+}
 
-#endif
+#endif // #if defined(BETTER_ENUMS_HAVE_CONSTEXPR) && ...
 
-#ifndef BETTER_ENUMS_CLASS_ATTRIBUTE
-#   define BETTER_ENUMS_CLASS_ATTRIBUTE
-#endif
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_name_scan(const char *name, std::size_t index = 0)
+{
+    return
+        index == Enum::_size() ? optional<std::size_t>() :
+        _names_match(_access<Enum>::raw_name(index), name) ?
+            optional<std::size_t>(index) :
+            _name_scan<Enum>(name, index + 1);
+}
 
-#define BETTER_ENUMS_TYPE(SetUnderlyingType, SwitchType, GenerateSwitchType,   \
-                          GenerateStrings, ToStringConstexpr,                  \
-                          DeclareInitialize, DefineInitialize, CallInitialize, \
-                          Enum, Underlying, ...)                               \
-                                                                               \
-namespace better_enums_data_ ## Enum {                                         \
-                                                                               \
-BETTER_ENUMS_ID(GenerateSwitchType(Underlying, __VA_ARGS__))                   \
-                                                                               \
-}                                                                              \
-                                                                               \
-class BETTER_ENUMS_CLASS_ATTRIBUTE Enum {                                                                   \
-  private:                                                                     \
-    typedef ::better_enums::optional<Enum>                  _optional;         \
-    typedef ::better_enums::optional<std::size_t>           _optional_index;   \
-                                                                               \
-  public:                                                                      \
-    typedef Underlying                                      _integral;         \
-                                                                               \
-    enum _enumerated SetUnderlyingType(Underlying) { __VA_ARGS__ };            \
-                                                                               \
-    BETTER_ENUMS_CONSTEXPR_ Enum(_enumerated value) : _value(value) { }        \
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_name_scan_nocase(const char *name, std::size_t index = 0)
+{
+    return
+        index == Enum::_size() ? optional<std::size_t>() :
+        _names_match_nocase(_access<Enum>::raw_name(index), name) ?
+            optional<std::size_t>(index) :
+            _name_scan_nocase<Enum>(name, index + 1);
+}
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_name_scan_length(const char *name, std::size_t length, std::size_t index = 0)
+{
+    return
+        index == Enum::_size() ? optional<std::size_t>() :
+        _name_has_length<Enum>(index, length) &&
+        _names_match_length(_access<Enum>::raw_name(index), name, length) ?
+            optional<std::size_t>(index) :
+            _name_scan_length<Enum>(name, length, index + 1);
+}
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_name_scan_length_nocase(const char *name, std::size_t length,
+                         std::size_t index = 0)
+{
+    return
+        index == Enum::_size() ? optional<std::size_t>() :
+        _name_has_length<Enum>(index, length) &&
+        _names_match_length_nocase(_access<Enum>::raw_name(index), name,
+                                   length) ?
+            optional<std::size_t>(index) :
+            _name_scan_length_nocase<Enum>(name, length, index + 1);
+}
+
+// Name scans that are not templates. The names of an enum are described by a
+// pair of its raw names and their count. One copy of each scan is then shared
+// by all enums in the program, instead of one copy being instantiated, and
+// often inlined, for each enum. These are used in compact mode, and by
+// better_enums::descriptor.
+
+struct _descriptor {
+    BETTER_ENUMS_CONSTEXPR_ _descriptor(const char * const *raw_names_,
+                                        std::size_t size_) :
+        raw_names(raw_names_), size(size_) { }
+
+    const char * const  *raw_names;
+    std::size_t         size;
+};
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline _descriptor _describe()
+{
+    return _descriptor(_access<Enum>::raw_names(), Enum::_size());
+}
+
+BETTER_ENUMS_CONSTEXPR_ BETTER_ENUMS_NOINLINE inline optional<std::size_t>
+_descriptor_scan(_descriptor names, const char *name, std::size_t index = 0)
+{
+    return
+        index == names.size ? optional<std::size_t>() :
+        _names_match(names.raw_names[index], name) ?
+            optional<std::size_t>(index) :
+            _descriptor_scan(names, name, index + 1);
+}
+
+BETTER_ENUMS_CONSTEXPR_ BETTER_ENUMS_NOINLINE inline optional<std::size_t>
+_descriptor_scan_nocase(_descriptor names, const char *name,
+                        std::size_t index = 0)
+{
+    return
+        index == names.size ? optional<std::size_t>() :
+        _names_match_nocase(names.raw_names[index], name) ?
+            optional<std::size_t>(index) :
+            _descriptor_scan_nocase(names, name, index + 1);
+}
+
+BETTER_ENUMS_CONSTEXPR_ BETTER_ENUMS_NOINLINE inline optional<std::size_t>
+_descriptor_scan_length(_descriptor names, const char *name,
+                        std::size_t length, std::size_t index = 0)
+{
+    return
+        index == names.size ? optional<std::size_t>() :
+        _names_match_length(names.raw_names[index], name, length) ?
+            optional<std::size_t>(index) :
+            _descriptor_scan_length(names, name, length, index + 1);
+}
+
+BETTER_ENUMS_CONSTEXPR_ BETTER_ENUMS_NOINLINE inline optional<std::size_t>
+_descriptor_scan_length_nocase(_descriptor names, const char *name,
+                               std::size_t length, std::size_t index = 0)
+{
+    return
+        index == names.size ? optional<std::size_t>() :
+        _names_match_length_nocase(names.raw_names[index], name, length) ?
+            optional<std::size_t>(index) :
+            _descriptor_scan_length_nocase(names, name, length, index + 1);
+}
+
+// Probe order. By default, names are compared with the constants in declaration
+// order. If an enum has been given a list of hot constants with
+// BETTER_ENUMS_DECLARE_HOT_CONSTANTS, the exact lookups first compare the name
+// with the hot constants, in the order listed, and then fall back to the scan
+// in declaration order, which is the cold scan below. A constant's name is
+// unique, so the order doesn't change the result. Case-insensitive lookups
+// always scan in declaration order, because they return the first constant that
+// matches. The hash table, if enabled, doesn't use the probe order.
+template <typename Enum>
+struct _hot_constants {
+    BETTER_ENUMS_CONSTEXPR_ static std::size_t count() { return 0; }
+    BETTER_ENUMS_CONSTEXPR_ static std::size_t index(std::size_t) { return 0; }
+};
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_cold_name_scan(const char *name);
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_cold_name_scan_length(const char *name, std::size_t length);
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_hot_name_scan(const char *name, std::size_t position = 0)
+{
+    return
+        position == _hot_constants<Enum>::count() ?
+            _cold_name_scan<Enum>(name) :
+        _names_match(
+            _access<Enum>::raw_name(_hot_constants<Enum>::index(position)),
+            name) ?
+            optional<std::size_t>(_hot_constants<Enum>::index(position)) :
+            _hot_name_scan<Enum>(name, position + 1);
+}
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_hot_name_scan_length(const char *name, std::size_t length,
+                      std::size_t position = 0)
+{
+    return
+        position == _hot_constants<Enum>::count() ?
+            _cold_name_scan_length<Enum>(name, length) :
+        _name_has_length<Enum>(_hot_constants<Enum>::index(position), length) &&
+        _names_match_length(
+            _access<Enum>::raw_name(_hot_constants<Enum>::index(position)),
+            name, length) ?
+            optional<std::size_t>(_hot_constants<Enum>::index(position)) :
+            _hot_name_scan_length<Enum>(name, length, position + 1);
+}
+
+#ifdef BETTER_ENUMS_COMPACT
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_cold_name_scan(const char *name)
+{
+    return _descriptor_scan(_describe<Enum>(), name);
+}
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_cold_name_scan_length(const char *name, std::size_t length)
+{
+    return _descriptor_scan_length(_describe<Enum>(), name, length);
+}
+
+template <typename Enum, lookup_strategy Strategy>
+struct _name_index {
+    BETTER_ENUMS_CONSTEXPR_ static optional<std::size_t>
+    find(const char *name) { return _hot_name_scan<Enum>(name); }
+
+    BETTER_ENUMS_CONSTEXPR_ static optional<std::size_t>
+    find_nocase(const char *name)
+        { return _descriptor_scan_nocase(_describe<Enum>(), name); }
+
+    BETTER_ENUMS_CONSTEXPR_ static optional<std::size_t>
+    find(const char *name, std::size_t length)
+        { return _hot_name_scan_length<Enum>(name, length); }
+
+    BETTER_ENUMS_CONSTEXPR_ static optional<std::size_t>
+    find_nocase(const char *name, std::size_t length)
+    {
+        return
+            _descriptor_scan_length_nocase(_describe<Enum>(), name, length);
+    }
+};
+
+#else
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_cold_name_scan(const char *name)
+{
+    return _name_scan<Enum>(name);
+}
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_cold_name_scan_length(const char *name, std::size_t length)
+{
+    return _name_scan_length<Enum>(name, length);
+}
+
+template <typename Enum, lookup_strategy Strategy>
+struct _name_index {
+    BETTER_ENUMS_CONSTEXPR_ static optional<std::size_t>
+    find(const char *name) { return _hot_name_scan<Enum>(name); }
+
+    BETTER_ENUMS_CONSTEXPR_ static optional<std::size_t>
+    find_nocase(const char *name) { return _name_scan_nocase<Enum>(name); }
+
+    BETTER_ENUMS_CONSTEXPR_ static optional<std::size_t>
+    find(const char *name, std::size_t length)
+        { return _hot_name_scan_length<Enum>(name, length); }
+
+    BETTER_ENUMS_CONSTEXPR_ static optional<std::size_t>
+    find_nocase(const char *name, std::size_t length)
+        { return _name_scan_length_nocase<Enum>(name, length); }
+};
+
+#endif // #ifdef BETTER_ENUMS_COMPACT
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+// 32-bit FNV-1a. Constant names are hashed up to the end of the name, which in
+// an unprocessed constant string is also the start of its initializer. Strings
+// being looked up are hashed over their given length. Names are hashed up to
+// case, so that one table serves both the exact and the case-insensitive
+// lookups. Names that differ only in case share a chain, and are then told
+// apart by the final comparison.
+
+constexpr unsigned int _hash_basis = 2166136261u;
+
+constexpr unsigned int _hash_step(unsigned int hash, char c)
+{
+    return (hash ^ static_cast<unsigned char>(_to_lower_ascii(c))) * 16777619u;
+}
+
+constexpr unsigned int _hash_name(const char *name,
+                                  unsigned int hash = _hash_basis,
+                                  std::size_t index = 0)
+{
+    return
+        _ends_name(name[index]) ? hash :
+        _hash_name(name, _hash_step(hash, name[index]), index + 1);
+}
+
+constexpr unsigned int _hash_chars(const char *s, std::size_t length,
+                                   unsigned int hash = _hash_basis,
+                                   std::size_t index = 0)
+{
+    return
+        index == length ? hash :
+        _hash_chars(s, length, _hash_step(hash, s[index]), index + 1);
+}
+
+// Number of hash buckets for an enum: the smallest power of two that is at
+// least twice the number of constants.
+constexpr std::size_t _bucket_count(std::size_t count, std::size_t buckets = 1)
+{
+    return buckets >= 2 * count ? buckets : _bucket_count(count, buckets * 2);
+}
+
+// Index of the first constant at or after index whose hash falls into the
+// given bucket, or count if there is none.
+constexpr std::size_t _first_in_bucket(const unsigned int *hashes,
+                                       std::size_t count, std::size_t bucket,
+                                       std::size_t index)
+{
+    return
+        index >= count ? count :
+        (hashes[index] & (_bucket_count(count) - 1)) == bucket ? index :
+        _first_in_bucket(hashes, count, bucket, index + 1);
+}
+
+template <typename Enum, typename Buckets, typename Indices>
+struct _name_hash_table;
+
+// Each bucket is a chain of constants: heads gives the first constant in each
+// bucket, and next gives the following constant in the same bucket. Chains are
+// in declaration order, so that the first matching constant is found first,
+// as with a linear scan.
+template <typename Enum, std::size_t... Buckets, std::size_t... Indices>
+struct _name_hash_table<Enum, _index_sequence<Buckets...>,
+                        _index_sequence<Indices...> > {
+    typedef typename _compact_index<Enum::_size_constant>::type     entry;
+
+    static constexpr std::size_t    count = sizeof...(Indices);
+
+    static constexpr unsigned int   hashes[] =
+        { _hash_name(_access<Enum>::raw_name(Indices))... };
+    static constexpr entry          heads[] =
+        { static_cast<entry>(
+            _first_in_bucket(hashes, count, Buckets, 0))... };
+    static constexpr entry          next[] =
+        { static_cast<entry>(
+            _first_in_bucket(hashes, count,
+                             hashes[Indices] & (sizeof...(Buckets) - 1),
+                             Indices + 1))... };
+};
+
+template <typename Enum, std::size_t... Buckets, std::size_t... Indices>
+constexpr unsigned int
+_name_hash_table<Enum, _index_sequence<Buckets...>,
+                 _index_sequence<Indices...> >::hashes[];
+
+template <typename Enum, std::size_t... Buckets, std::size_t... Indices>
+constexpr typename _name_hash_table<Enum, _index_sequence<Buckets...>,
+                                    _index_sequence<Indices...> >::entry
+_name_hash_table<Enum, _index_sequence<Buckets...>,
+                 _index_sequence<Indices...> >::heads[];
+
+template <typename Enum, std::size_t... Buckets, std::size_t... Indices>
+constexpr typename _name_hash_table<Enum, _index_sequence<Buckets...>,
+                                    _index_sequence<Indices...> >::entry
+_name_hash_table<Enum, _index_sequence<Buckets...>,
+                 _index_sequence<Indices...> >::next[];
+
+template <typename Enum, bool Nocase>
+struct _name_hash_lookup {
+    constexpr static optional<std::size_t>
+    find(const char *name, std::size_t length)
+    {
+        return
+            length > _longest_name<Enum>() ? optional<std::size_t>() :
+            in_bucket(name, length, _hash_chars(name, length));
+    }
+
+  private:
+    static constexpr std::size_t    buckets = _bucket_count(Enum::_size());
+
+    typedef _name_hash_table<
+        Enum, typename _make_index_sequence<buckets>::type,
+        typename _make_index_sequence<Enum::_size_constant>::type>  table;
+
+    constexpr static optional<std::size_t>
+    in_bucket(const char *name, std::size_t length, unsigned int hash)
+    {
+        return chain(name, length, hash, table::heads[hash & (buckets - 1)]);
+    }
+
+    constexpr static bool
+    matches(const char *name, std::size_t length, std::size_t index)
+    {
+        return
+            Nocase ?
+                _names_match_length_nocase(_access<Enum>::raw_name(index),
+                                           name, length) :
+                _names_match_length(_access<Enum>::raw_name(index), name,
+                                    length);
+    }
+
+    constexpr static optional<std::size_t>
+    chain(const char *name, std::size_t length, unsigned int hash,
+          std::size_t index)
+    {
+        return
+            index >= Enum::_size() ? optional<std::size_t>() :
+            table::hashes[index] == hash &&
+            _name_has_length<Enum>(index, length) &&
+            matches(name, length, index) ?
+                optional<std::size_t>(index) :
+            chain(name, length, hash, table::next[index]);
+    }
+};
+
+// A null-terminated string is measured first, so that it is hashed over its
+// length. Measuring stops just past the longest name: a longer string cannot
+// match, and is not traversed further.
+template <typename Enum>
+struct _name_index<Enum, hash_lookup> {
+    constexpr static optional<std::size_t> find(const char *name)
+    {
+        return find(name, _string_length(name, _longest_name<Enum>() + 1));
+    }
+
+    constexpr static optional<std::size_t> find_nocase(const char *name)
+    {
+        return
+            find_nocase(name, _string_length(name, _longest_name<Enum>() + 1));
+    }
+
+    constexpr static optional<std::size_t>
+    find(const char *name, std::size_t length)
+    {
+        return _name_hash_lookup<Enum, false>::find(name, length);
+    }
+
+    constexpr static optional<std::size_t>
+    find_nocase(const char *name, std::size_t length)
+    {
+        return _name_hash_lookup<Enum, true>::find(name, length);
+    }
+};
+
+#endif // #ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+
+
+// Stream input. Wide characters are narrowed before the name is looked up; a
+// character with no narrow equivalent becomes '\0', which matches no name.
+
+template <typename Char, typename Traits>
+inline const char* _narrow(const std::basic_ios<Char, Traits> &stream,
+                           const Char *from, std::size_t length, char *to)
+{
+    for (std::size_t index = 0; index < length; ++index)
+        to[index] = stream.narrow(from[index], '\0');
+
+    return to;
+}
+
+template <typename Traits>
+inline const char* _narrow(const std::basic_ios<char, Traits>&,
+                           const char *from, std::size_t, char*)
+{
+    return from;
+}
+
+// Without constexpr, the string type is named through a template, so that it
+// needs to be complete only where the stream operator is used.
+template <typename Char>
+struct _narrow_string { typedef std::basic_string<char> type; };
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+// Reads a token into a buffer on the stack. At most limit - 1 characters are
+// read, or fewer if the stream has a smaller width. A token longer than the
+// longest name is therefore rejected after reading only one character more than
+// that name; the rest of it is left in the stream.
+template <typename Char, typename Traits, std::size_t Capacity>
+inline void _read_token(std::basic_istream<Char, Traits> &stream,
+                        Char (&buffer)[Capacity], std::size_t limit)
+{
+    std::streamsize     width = stream.width();
+    if (width <= 0 || width >= static_cast<std::streamsize>(limit))
+        width = static_cast<std::streamsize>(limit);
+    else
+        ++width;
+
+    buffer[0] = Char();
+    stream.width(width);
+    stream >> buffer;
+}
+
+#endif // #ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+#ifdef BETTER_ENUMS_COMPACT
+
+// In compact mode, the token is read and looked up by one function for each
+// stream type, which is shared by all enums. With constexpr, the token is read
+// into a buffer on the stack, with room for one character more than the longest
+// name. The capacity of the buffer is rounded up, so that enums with names of
+// similar lengths share one copy of the function, and the limit on the length
+// of the token is passed separately. Without constexpr, the token is read into
+// a string.
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+template <std::size_t Capacity, typename Char, typename Traits>
+BETTER_ENUMS_NOINLINE optional<std::size_t>
+_read_index(std::basic_istream<Char, Traits> &stream, _descriptor names,
+            std::size_t limit)
+{
+    Char                                buffer[Capacity];
+    char                                narrowed[Capacity];
+
+    _read_token(stream, buffer, limit);
+
+    if (stream.fail())
+        return optional<std::size_t>();
+
+    std::size_t                         length = Traits::length(buffer);
+    optional<std::size_t>               index =
+        _descriptor_scan_length(
+            names, _narrow(stream, buffer, length, narrowed), length);
+
+    if (!index)
+        stream.setstate(std::basic_istream<Char, Traits>::failbit);
+
+    return index;
+}
+
+#else
+
+template <typename Char, typename Traits>
+BETTER_ENUMS_NOINLINE optional<std::size_t>
+_read_index(std::basic_istream<Char, Traits> &stream, _descriptor names)
+{
+    std::basic_string<Char, Traits>     buffer;
+    stream >> buffer;
+
+    if (stream.fail())
+        return optional<std::size_t>();
+
+    typename _narrow_string<Char>::type storage(buffer.size() + 1, '\0');
+
+    optional<std::size_t>   index =
+        _descriptor_scan_length(
+            names, _narrow(stream, buffer.data(), buffer.size(), &storage[0]),
+            buffer.size());
+
+    if (!index)
+        stream.setstate(std::basic_istream<Char, Traits>::failbit);
+
+    return index;
+}
+
+#endif // #ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+template <typename Enum, typename Char, typename Traits>
+std::basic_istream<Char, Traits>&
+_read_enum(std::basic_istream<Char, Traits> &stream, Enum &value)
+{
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+    constexpr std::size_t   limit = _longest_name<Enum>() + 2;
+
+    optional<std::size_t>   index =
+        _read_index<(limit + 15) / 16 * 16>(stream, _describe<Enum>(), limit);
+#else
+    optional<std::size_t>   index = _read_index(stream, _describe<Enum>());
+#endif
+
+    if (index)
+        value = Enum::_values()[*index];
+
+    return stream;
+}
+
+#else
+
+// With constexpr, the name is read into a buffer on the stack, which has room
+// for one character more than the longest name. Without constexpr, the token is
+// read into a string.
+template <typename Enum, typename Char, typename Traits>
+std::basic_istream<Char, Traits>&
+_read_enum(std::basic_istream<Char, Traits> &stream, Enum &value)
+{
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+    constexpr std::size_t               capacity = _longest_name<Enum>() + 2;
+
+    Char                                buffer[capacity];
+    char                                narrowed[capacity];
+
+    _read_token(stream, buffer, capacity);
+
+    const Char                          *token = buffer;
+    std::size_t                         length = Traits::length(buffer);
+#else
+    std::basic_string<Char, Traits>     buffer;
+    stream >> buffer;
+
+    const Char                          *token = buffer.data();
+    std::size_t                         length = buffer.size();
+
+    typename _narrow_string<Char>::type storage(length + 1, '\0');
+    char                                *narrowed = &storage[0];
+#endif
+
+    if (!stream.fail()) {
+        optional<Enum>  converted =
+            Enum::_from_string_nothrow(
+                _narrow(stream, token, length, narrowed), length);
+
+        if (converted)
+            value = *converted;
+        else
+            stream.setstate(std::basic_istream<Char, Traits>::failbit);
+    }
+
+    return stream;
+}
+
+#endif // #ifdef BETTER_ENUMS_COMPACT
+
+// Character output. to_chars copies the name of a value into a buffer with one
+// memcpy, using the name length that _to_string_length returns, so the name is
+// not scanned, and no stream or locale is involved.
+
+// As with std::to_chars, ptr points one past the last character written, and no
+// null character is written. If the name doesn't fit, ok is false and ptr is
+// last. If the value is not equal to any declared constant, ok is false and ptr
+// is first.
+struct to_chars_result {
+    char    *ptr;
+    bool    ok;
+};
+
+inline to_chars_result _no_name(char *first)
+{
+    to_chars_result result = { first, false };
+    return result;
+}
+
+inline to_chars_result
+_copy_name(char *first, char *last, const char *name, std::size_t length)
+{
+    if (static_cast<std::size_t>(last - first) < length) {
+        to_chars_result result = { last, false };
+        return result;
+    }
+
+    std::memcpy(first, name, length);
+
+    to_chars_result result = { first + length, true };
+    return result;
+}
+
+template <typename Enum>
+inline to_chars_result to_chars(char *first, char *last, Enum value)
+{
+    std::size_t     length = 0;
+    const char      *name = _access<Enum>::name(value, length);
+
+    return name ? _copy_name(first, last, name, length) : _no_name(first);
+}
+
+// Lists of nodes with static storage duration, such as the instrumentation
+// nodes and the descriptor registry. Nodes are only ever pushed to the front.
+// In C++11, a push is a compare-and-swap loop, and the new node is published
+// with release ordering, so nodes can be pushed from any thread while others
+// walk the list. In C++98, pushes are not synchronized.
+
+#if defined(BETTER_ENUMS_INSTRUMENT) || defined(BETTER_ENUMS_REGISTRY)
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+template <typename Node>
+struct _list_head { typedef std::atomic<Node*>  type; };
+
+template <typename Node>
+inline void _list_push(std::atomic<Node*> &head, Node &node)
+{
+    Node    *next = head.load(std::memory_order_relaxed);
+
+    do {
+        node.next = next;
+    } while (!head.compare_exchange_weak(next, &node,
+                                         std::memory_order_release,
+                                         std::memory_order_relaxed));
+}
+
+template <typename Node>
+inline Node* _list_first(const std::atomic<Node*> &head)
+{
+    return head.load(std::memory_order_acquire);
+}
+
+#else
+
+template <typename Node>
+struct _list_head { typedef Node*   type; };
+
+template <typename Node>
+inline void _list_push(Node *&head, Node &node)
+{
+    node.next = head;
+    head = &node;
+}
+
+template <typename Node>
+inline Node* _list_first(Node *head) { return head; }
+
+#endif // #ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+#endif // #if defined(BETTER_ENUMS_INSTRUMENT) || ...
+
+// Instrumentation. Each instrumented enum has a node with counts of lookups and
+// misses for each kind of conversion. The nodes are registered in a list on
+// first use, which snapshot_conversion_counters walks. In C++11, the counts are
+// relaxed atomics, split into shards with one cache line each, so that threads
+// converting the same enum don't often write to the same line. Each thread gets
+// a shard when it first converts. In C++98, there is one shard of plain counts,
+// which must not be updated from more than one thread at a time.
+
+#ifdef BETTER_ENUMS_INSTRUMENT
+
+enum _instrument_counter {
+    _from_integral_counter,
+    _from_string_counter,
+    _from_string_nocase_counter,
+    _to_string_counter,
+    _instrument_counter_count
+};
+
+// The conversion counts of one enum, as returned by conversion_counters_of and
+// snapshot_conversion_counters. Each miss is also counted as a lookup.
+struct conversion_counters {
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+    typedef unsigned long long  count;
+#else
+    typedef unsigned long       count;
+#endif
+
+    const char      *type_name;
+    count           from_integral;
+    count           from_integral_misses;
+    count           from_string;
+    count           from_string_misses;
+    count           from_string_nocase;
+    count           from_string_nocase_misses;
+    count           to_string;
+    count           to_string_misses;
+};
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+struct alignas(64) _instrument_shard {
+    std::atomic<conversion_counters::count>
+                    counts[2 * _instrument_counter_count];
+};
+
+struct _instrument_node {
+    const char              *type_name;
+    _instrument_node        *next;
+    _instrument_shard       shards[BETTER_ENUMS_INSTRUMENT_SHARDS];
+};
+
+inline std::size_t _instrument_shard_index()
+{
+    static std::atomic<std::size_t>     next_shard(0);
+    thread_local std::size_t            shard =
+        next_shard.fetch_add(1, std::memory_order_relaxed) %
+        BETTER_ENUMS_INSTRUMENT_SHARDS;
+
+    return shard;
+}
+
+BETTER_ENUMS_NOINLINE inline void
+_instrument_record(_instrument_node &node, std::size_t counter, bool miss)
+{
+    std::atomic<conversion_counters::count>     *counts =
+        node.shards[_instrument_shard_index()].counts;
+
+    counts[2 * counter].fetch_add(1, std::memory_order_relaxed);
+    if (miss)
+        counts[2 * counter + 1].fetch_add(1, std::memory_order_relaxed);
+}
+
+inline conversion_counters::count
+_instrument_total(const _instrument_node &node, std::size_t counter)
+{
+    conversion_counters::count  total = 0;
+
+    for (std::size_t shard = 0; shard < BETTER_ENUMS_INSTRUMENT_SHARDS;
+         ++shard) {
+
+        total +=
+            node.shards[shard].counts[counter].load(std::memory_order_relaxed);
+    }
+
+    return total;
+}
+
+#else
+
+struct _instrument_node {
+    const char                  *type_name;
+    _instrument_node            *next;
+    conversion_counters::count  counts[2 * _instrument_counter_count];
+};
+
+BETTER_ENUMS_NOINLINE inline void
+_instrument_record(_instrument_node &node, std::size_t counter, bool miss)
+{
+    ++node.counts[2 * counter];
+    if (miss)
+        ++node.counts[2 * counter + 1];
+}
+
+inline conversion_counters::count
+_instrument_total(const _instrument_node &node, std::size_t counter)
+{
+    return node.counts[counter];
+}
+
+#endif // #ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+inline _list_head<_instrument_node>::type& _instrument_head()
+{
+    static _list_head<_instrument_node>::type   head(BETTER_ENUMS_NULLPTR);
+    return head;
+}
+
+inline _instrument_node& _instrument_register(_instrument_node &node,
+                                              const char *type_name)
+{
+    node.type_name = type_name;
+    _list_push(_instrument_head(), node);
+
+    return node;
+}
+
+inline _instrument_node* _instrument_first()
+{
+    return _list_first(_instrument_head());
+}
+
+// Zero-initialized before any dynamic initialization, so an enum can be
+// converted, and counted, during static initialization.
+template <typename Enum>
+struct _instrument_storage {
+    static _instrument_node     node;
+};
+
+template <typename Enum>
+_instrument_node _instrument_storage<Enum>::node;
+
+template <typename Enum>
+inline _instrument_node& _instrument_node_of()
+{
+    static _instrument_node &node =
+        _instrument_register(_instrument_storage<Enum>::node, Enum::_name());
+
+    return node;
+}
+
+template <typename Enum>
+inline optional<std::size_t>
+_instrument_runtime(_instrument_counter counter, optional<std::size_t> index)
+{
+    _instrument_record(_instrument_node_of<Enum>(), counter, !index);
+    return index;
+}
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<std::size_t>
+_instrument(_instrument_counter counter, optional<std::size_t> index)
+{
+    return
+        BETTER_ENUMS_IS_CONSTANT_EVALUATED() ?
+            index : _instrument_runtime<Enum>(counter, index);
+}
+
+inline conversion_counters _instrument_snapshot(const _instrument_node &node)
+{
+    conversion_counters     counters;
+
+    counters.type_name = node.type_name;
+    counters.from_integral = _instrument_total(node, 0);
+    counters.from_integral_misses = _instrument_total(node, 1);
+    counters.from_string = _instrument_total(node, 2);
+    counters.from_string_misses = _instrument_total(node, 3);
+    counters.from_string_nocase = _instrument_total(node, 4);
+    counters.from_string_nocase_misses = _instrument_total(node, 5);
+    counters.to_string = _instrument_total(node, 6);
+    counters.to_string_misses = _instrument_total(node, 7);
+
+    return counters;
+}
+
+// Returns the current counts of conversions of Enum. Counts being updated by
+// other threads at the same time may or may not be included.
+template <typename Enum>
+inline conversion_counters conversion_counters_of()
+{
+    return _instrument_snapshot(_instrument_node_of<Enum>());
+}
+
+// Copies the counts of up to capacity instrumented enums into counters, and
+// returns the number of instrumented enums, which may be greater than capacity.
+// An enum is included once it has been converted, or passed to
+// conversion_counters_of. The most recently included enums are first.
+inline std::size_t
+snapshot_conversion_counters(conversion_counters *counters,
+                             std::size_t capacity)
+{
+    std::size_t     count = 0;
+
+    for (const _instrument_node *node = _instrument_first();
+         node != BETTER_ENUMS_NULLPTR; node = node->next, ++count) {
+
+        if (count < capacity)
+            counters[count] = _instrument_snapshot(*node);
+    }
+
+    return count;
+}
+
+#endif // #ifdef BETTER_ENUMS_INSTRUMENT
+
+// Eager initialization.
+template <typename Enum>
+struct _initialize_at_program_start {
+    _initialize_at_program_start() { Enum::initialize(); }
+};
+
+} // namespace better_enums
+
+
+
+// Array generation macros.
+
+#define BETTER_ENUMS_EAT_ASSIGN_SINGLE(EnumType, index, expression)            \
+    (EnumType)((::better_enums::_eat_assign<EnumType>)EnumType::expression),
+
+#define BETTER_ENUMS_EAT_ASSIGN(EnumType, ...)                                 \
+    BETTER_ENUMS_ID(                                                           \
+        BETTER_ENUMS_PP_MAP(                                                   \
+            BETTER_ENUMS_EAT_ASSIGN_SINGLE, EnumType, __VA_ARGS__))
+
+
+
+// Switch generation macros, for better_enums::visit. There is one case for each
+// constant, labeled with the constant's index rather than its value, because
+// constants that have the same value would otherwise give duplicate labels.
+
+#define BETTER_ENUMS_VISIT_CASE(EnumType, index, expression)                   \
+    case index:                                                                \
+        return visitor(::better_enums::index_constant<EnumType, index>());
+
+#define BETTER_ENUMS_VISIT_CASES(EnumType, ...)                                \
+    BETTER_ENUMS_ID(                                                           \
+        BETTER_ENUMS_PP_MAP(                                                   \
+            BETTER_ENUMS_VISIT_CASE, EnumType, __VA_ARGS__))
+
+
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+
+
+#define BETTER_ENUMS_SELECT_SINGLE_CHARACTER(from, from_length, index)         \
+    ::better_enums::_select(from, from_length, index),
+
+#define BETTER_ENUMS_SELECT_CHARACTERS(from, from_length)                      \
+    BETTER_ENUMS_ITERATE(                                                      \
+        BETTER_ENUMS_SELECT_SINGLE_CHARACTER, from, from_length)
+
+
+
+#define BETTER_ENUMS_TRIM_SINGLE_STRING(ignored, index, expression)            \
+constexpr std::size_t   _length_ ## index =                                    \
+    ::better_enums::_constant_length(#expression);                             \
+constexpr const char    _trimmed_ ## index [] =                                \
+    { BETTER_ENUMS_SELECT_CHARACTERS(#expression, _length_ ## index) };        \
+constexpr const char    *_final_ ## index =                                    \
+    ::better_enums::_has_initializer(#expression) ?                            \
+        _trimmed_ ## index : #expression;
+
+#define BETTER_ENUMS_TRIM_STRINGS(...)                                         \
+    BETTER_ENUMS_ID(                                                           \
+        BETTER_ENUMS_PP_MAP(                                                   \
+            BETTER_ENUMS_TRIM_SINGLE_STRING, ignored, __VA_ARGS__))
+
+
+
+#define BETTER_ENUMS_REFER_TO_SINGLE_STRING(ignored, index, expression)        \
+    _final_ ## index,
+
+#define BETTER_ENUMS_REFER_TO_STRINGS(...)                                     \
+    BETTER_ENUMS_ID(                                                           \
+        BETTER_ENUMS_PP_MAP(                                                   \
+            BETTER_ENUMS_REFER_TO_SINGLE_STRING, ignored, __VA_ARGS__))
+
+
+
+#endif // #ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+
+
+#define BETTER_ENUMS_STRINGIZE_SINGLE(ignored, index, expression)  #expression,
+
+#define BETTER_ENUMS_STRINGIZE(...)                                            \
+    BETTER_ENUMS_ID(                                                           \
+        BETTER_ENUMS_PP_MAP(                                                   \
+            BETTER_ENUMS_STRINGIZE_SINGLE, ignored, __VA_ARGS__))
+
+#define BETTER_ENUMS_RESERVE_STORAGE_SINGLE(ignored, index, expression)        \
+    #expression ","
+
+#define BETTER_ENUMS_RESERVE_STORAGE(...)                                      \
+    BETTER_ENUMS_ID(                                                           \
+        BETTER_ENUMS_PP_MAP(                                                   \
+            BETTER_ENUMS_RESERVE_STORAGE_SINGLE, ignored, __VA_ARGS__))
+
+
+
+// The enums proper.
+
+#define BETTER_ENUMS_NS(EnumType)  better_enums_data_ ## EnumType
+
+#ifdef BETTER_ENUMS_VC2008_WORKAROUNDS
+
+#define BETTER_ENUMS_COPY_CONSTRUCTOR(Enum)                                    \
+        BETTER_ENUMS_CONSTEXPR_ Enum(const Enum &other) :                      \
+            _value(other._value) { }
+
+#else
+
+#define BETTER_ENUMS_COPY_CONSTRUCTOR(Enum)
+
+#endif
+
+#ifndef BETTER_ENUMS_CLASS_ATTRIBUTE
+#   define BETTER_ENUMS_CLASS_ATTRIBUTE
+#endif
+
+#define BETTER_ENUMS_TYPE(SetUnderlyingType, SwitchType, GenerateSwitchType,   \
+                          IfNames, NameConstexpr, NameRelaxedConstexpr,        \
+                          Names, GenerateStrings, ToStringConstexpr,           \
+                          DeclareInitialize, DefineInitialize, CallInitialize, \
+                          Enum, Underlying, ...)                               \
+                                                                               \
+namespace better_enums_data_ ## Enum {                                         \
+                                                                               \
+BETTER_ENUMS_ID(GenerateSwitchType(Underlying, __VA_ARGS__))                   \
+                                                                               \
+}                                                                              \
+                                                                               \
+class BETTER_ENUMS_CLASS_ATTRIBUTE Enum {                                                                   \
+  private:                                                                     \
+    typedef ::better_enums::optional<Enum>                  _optional;         \
+    typedef ::better_enums::optional<std::size_t>           _optional_index;   \
+                                                                               \
+  public:                                                                      \
+    typedef Underlying                                      _integral;         \
+                                                                               \
+    enum _enumerated SetUnderlyingType(Underlying) { __VA_ARGS__ };            \
+                                                                               \
+    BETTER_ENUMS_CONSTEXPR_ Enum(_enumerated value) : _value(value) { }        \
+                                                                               \
+    BETTER_ENUMS_COPY_CONSTRUCTOR(Enum)                                        \
+                                                                               \
+    BETTER_ENUMS_CONSTEXPR_ operator SwitchType(Enum)() const                  \
+    {                                                                          \
+        return SwitchType(Enum)(_value);                                       \
+    }                                                                          \
+                                                                               \
+    BETTER_ENUMS_CONSTEXPR_ _integral _to_integral() const;                    \
+    BETTER_ENUMS_IF_EXCEPTIONS(                                                \
+    BETTER_ENUMS_CONSTEXPR_ static Enum _from_integral(_integral value);       \
+    )                                                                          \
+    BETTER_ENUMS_CONSTEXPR_ static Enum                                        \
+    _from_integral_unchecked(_integral value);                                 \
+    BETTER_ENUMS_CONSTEXPR_ static _optional                                   \
+    _from_integral_nothrow(_integral value);                                   \
+                                                                               \
+    BETTER_ENUMS_CONSTEXPR_ std::size_t _to_index() const;                     \
+    BETTER_ENUMS_IF_EXCEPTIONS(                                                \
+    BETTER_ENUMS_CONSTEXPR_ static Enum _from_index(std::size_t value);        \
+    )                                                                          \
+    BETTER_ENUMS_CONSTEXPR_ static Enum                                        \
+    _from_index_unchecked(std::size_t value);                                  \
+    BETTER_ENUMS_CONSTEXPR_ static _optional                                   \
+    _from_index_nothrow(std::size_t value);                                    \
+                                                                               \
+    BETTER_ENUMS_CONSTEXPR_ static bool _is_valid(_integral value);            \
+                                                                               \
+    IfNames(                                                                   \
+    ToStringConstexpr const char* _to_string() const;                          \
+    ToStringConstexpr std::size_t _to_string_length() const;                   \
+    BETTER_ENUMS_IF_STRING_VIEW(                                               \
+    ToStringConstexpr std::string_view _to_string_view() const;                \
+    )                                                                          \
+    BETTER_ENUMS_IF_WIDE_NAMES(                                                \
+    NameRelaxedConstexpr const wchar_t* _to_wstring() const;                   \
+    BETTER_ENUMS_IF_EXCEPTIONS(                                                \
+    NameRelaxedConstexpr static Enum                                           \
+    _from_wstring(const wchar_t *name);                                        \
+    )                                                                          \
+    NameRelaxedConstexpr static _optional                                      \
+    _from_wstring_nothrow(const wchar_t *name);                                \
+    NameRelaxedConstexpr static _optional                                      \
+    _from_wstring_nothrow(const wchar_t *name, std::size_t length);            \
+    )                                                                          \
+    BETTER_ENUMS_IF_EXCEPTIONS(                                                \
+    NameConstexpr static Enum _from_string(const char *name);                  \
+    )                                                                          \
+    NameConstexpr static _optional                                             \
+    _from_string_nothrow(const char *name);                                    \
+                                                                               \
+    BETTER_ENUMS_IF_EXCEPTIONS(                                                \
+    NameConstexpr static Enum _from_string_nocase(const char *name);           \
+    )                                                                          \
+    NameConstexpr static _optional                                             \
+    _from_string_nocase_nothrow(const char *name);                             \
+                                                                               \
+    NameConstexpr static bool _is_valid(const char *name);                     \
+    NameConstexpr static bool _is_valid_nocase(const char *name);              \
+                                                                               \
+    BETTER_ENUMS_IF_EXCEPTIONS(                                                \
+    NameConstexpr static Enum                                                  \
+    _from_string(const char *name, std::size_t length);                        \
+    )                                                                          \
+    NameConstexpr static _optional                                             \
+    _from_string_nothrow(const char *name, std::size_t length);                \
+    BETTER_ENUMS_IF_EXCEPTIONS(                                                \
+    NameConstexpr static Enum                                                  \
+    _from_string_nocase(const char *name, std::size_t length);                 \
+    )                                                                          \
+    NameConstexpr static _optional                                             \
+    _from_string_nocase_nothrow(const char *name, std::size_t length);         \
+    NameConstexpr static bool                                                  \
+    _is_valid(const char *name, std::size_t length);                           \
+    NameConstexpr static bool                                                  \
+    _is_valid_nocase(const char *name, std::size_t length);                    \
+                                                                               \
+    BETTER_ENUMS_IF_STRING_VIEW(                                               \
+    BETTER_ENUMS_IF_EXCEPTIONS(                                                \
+    NameConstexpr static Enum _from_string(std::string_view name);             \
+    NameConstexpr static Enum                                                  \
+    _from_string_nocase(std::string_view name);                                \
+    )                                                                          \
+    NameConstexpr static _optional                                             \
+    _from_string_nothrow(std::string_view name);                               \
+    NameConstexpr static _optional                                             \
+    _from_string_nocase_nothrow(std::string_view name);                        \
+    NameConstexpr static bool _is_valid(std::string_view name);                \
+    NameConstexpr static bool                                                  \
+    _is_valid_nocase(std::string_view name);                                   \
+    )                                                                          \
+    )                                                                          \
+                                                                               \
+    typedef ::better_enums::_iterable<Enum>             _value_iterable;       \
+    typedef _value_iterable::iterator                   _value_iterator;       \
+    IfNames(                                                                   \
+    typedef ::better_enums::_iterable<const char*>      _name_iterable;        \
+    typedef _name_iterable::iterator                    _name_iterator;        \
+    )                                                                          \
+                                                                               \
+    BETTER_ENUMS_CONSTEXPR_ static const std::size_t _size_constant =          \
+        BETTER_ENUMS_ID(BETTER_ENUMS_PP_COUNT(__VA_ARGS__));                   \
+    BETTER_ENUMS_CONSTEXPR_ static std::size_t _size()                         \
+        { return _size_constant; }                                             \
+                                                                               \
+    BETTER_ENUMS_CONSTEXPR_ static const char* _name();                        \
+    BETTER_ENUMS_CONSTEXPR_ static _value_iterable _values();                  \
+    IfNames(                                                                   \
+    ToStringConstexpr static _name_iterable _names();                          \
+    )                                                                          \
+                                                                               \
+    BETTER_ENUMS_CONSTEXPR_ static ::better_enums::lookup_strategy             \
+    _value_lookup_strategy();                                                  \
+    IfNames(                                                                   \
+    BETTER_ENUMS_CONSTEXPR_ static ::better_enums::lookup_strategy             \
+    _name_lookup_strategy();                                                   \
+    )                                                                          \
+                                                                               \
+    BETTER_ENUMS_CONSTEXPR_ static Enum _min_value();                          \
+    BETTER_ENUMS_CONSTEXPR_ static Enum _max_value();                          \
+    BETTER_ENUMS_CONSTEXPR_ static bool _is_contiguous();                      \
+    BETTER_ENUMS_CONSTEXPR_ static bool _is_sorted();                          \
+    BETTER_ENUMS_CONSTEXPR_ static double _density();                          \
+                                                                               \
+    _integral      _value;                                                     \
+                                                                               \
+    BETTER_ENUMS_DEFAULT_CONSTRUCTOR(Enum)                                     \
+                                                                               \
+  private:                                                                     \
+    explicit BETTER_ENUMS_CONSTEXPR_ Enum(const _integral &value) :            \
+        _value(value) { }                                                      \
+                                                                               \
+    IfNames(DeclareInitialize)                                                 \
+                                                                               \
+    BETTER_ENUMS_CONSTEXPR_ static _optional_index                             \
+    _from_value(_integral value);                                              \
+    IfNames(                                                                   \
+    NameConstexpr static _optional_index                                       \
+    _from_name(const char *name);                                              \
+    NameConstexpr static _optional_index                                       \
+    _from_name_nocase(const char *name);                                       \
+    NameConstexpr static _optional_index                                       \
+    _from_name(const char *name, std::size_t length);                          \
+    NameConstexpr static _optional_index                                       \
+    _from_name_nocase(const char *name, std::size_t length);                   \
+                                                                               \
+    BETTER_ENUMS_CONSTEXPR_ static const char * const * _raw_names();          \
+    BETTER_ENUMS_CONSTEXPR_ static const char* _raw_name(std::size_t index);   \
+    ToStringConstexpr static const char* _name_or_null(_optional_index index); \
+    ToStringConstexpr static std::size_t                                       \
+    _length_or_zero(_optional_index index);                                    \
+    BETTER_ENUMS_IF_STRING_VIEW(                                               \
+    ToStringConstexpr static std::string_view                                  \
+    _view_or_empty(_optional_index index);                                     \
+    )                                                                          \
+    )                                                                          \
+                                                                               \
+    template <typename Result, typename Visitor>                               \
+    static Result _visit(std::size_t index, Visitor &visitor)                  \
+    {                                                                          \
+        switch (index) {                                                       \
+            BETTER_ENUMS_ID(BETTER_ENUMS_VISIT_CASES(Enum, __VA_ARGS__))       \
+        }                                                                      \
+                                                                               \
+        return visitor(::better_enums::index_constant<Enum, 0>());             \
+    }                                                                          \
+                                                                               \
+    friend struct ::better_enums::_initialize_at_program_start<Enum>;          \
+    friend struct ::better_enums::_access<Enum>;                               \
+};                                                                             \
+                                                                               \
+namespace better_enums_data_ ## Enum {                                         \
+                                                                               \
+enum _putNamesInThisScopeAlso { __VA_ARGS__ };                                 \
+                                                                               \
+BETTER_ENUMS_IGNORE_OLD_CAST_HEADER                                            \
+BETTER_ENUMS_IGNORE_OLD_CAST_BEGIN                                             \
+BETTER_ENUMS_CONSTEXPR_ const Enum      _value_array[] =                       \
+    { BETTER_ENUMS_ID(BETTER_ENUMS_EAT_ASSIGN(Enum, __VA_ARGS__)) };           \
+BETTER_ENUMS_IGNORE_OLD_CAST_END                                               \
+                                                                               \
+}                                                                              \
+                                                                               \
+BETTER_ENUMS_IGNORE_ATTRIBUTES_HEADER                                          \
+BETTER_ENUMS_IGNORE_ATTRIBUTES_BEGIN                                           \
+BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
+inline const Enum                                                              \
+operator +(Enum::_enumerated enumerated)                                       \
+{                                                                              \
+    return static_cast<Enum>(enumerated);                                      \
+}                                                                              \
+BETTER_ENUMS_IGNORE_ATTRIBUTES_END                                             \
+                                                                               \
+BETTER_ENUMS_CONSTEXPR_ inline Enum::_integral Enum::_to_integral() const      \
+{                                                                              \
+    return _integral(_value);                                                  \
+}                                                                              \
+                                                                               \
+BETTER_ENUMS_CONSTEXPR_ inline std::size_t Enum::_to_index() const             \
+{                                                                              \
+    return *_from_value(_value);                                               \
+}                                                                              \
+                                                                               \
+BETTER_ENUMS_CONSTEXPR_ inline Enum                                            \
+Enum::_from_index_unchecked(std::size_t index)                                 \
+{                                                                              \
+    return                                                                     \
+        ::better_enums::_or_zero(_from_index_nothrow(index));                  \
+}                                                                              \
+                                                                               \
+BETTER_ENUMS_CONSTEXPR_ inline Enum::_optional                                 \
+Enum::_from_index_nothrow(std::size_t index)                                   \
+{                                                                              \
+    return                                                                     \
+        index >= _size() ?                                                     \
+            _optional() :                                                      \
+             _optional(BETTER_ENUMS_NS(Enum)::_value_array[index]);            \
+}                                                                              \
+                                                                               \
+BETTER_ENUMS_IF_EXCEPTIONS(                                                    \
+BETTER_ENUMS_CONSTEXPR_ inline Enum Enum::_from_index(std::size_t index)       \
+{                                                                              \
+    return                                                                     \
+        ::better_enums::_or_throw(_from_index_nothrow(index),                  \
+                                  #Enum "::_from_index: invalid argument");    \
+}                                                                              \
+)                                                                              \
                                                                                \
-    BETTER_ENUMS_COPY_CONSTRUCTOR(Enum)                                        \
+BETTER_ENUMS_CONSTEXPR_ inline Enum                                            \
+Enum::_from_integral_unchecked(_integral value)                                \
+{                                                                              \
+    return static_cast<_enumerated>(value);                                    \
+}                                                                              \
                                                                                \
-    BETTER_ENUMS_CONSTEXPR_ operator SwitchType(Enum)() const                  \
-    {                                                                          \
-        return SwitchType(Enum)(_value);                                       \
-    }                                                                          \
+BETTER_ENUMS_CONSTEXPR_ inline Enum::_optional                                 \
+Enum::_from_integral_nothrow(_integral value)                                  \
+{                                                                              \
+    return                                                                     \
+        ::better_enums::_map_index<Enum>(                                      \
+            BETTER_ENUMS_NS(Enum)::_value_array,                               \
+            BETTER_ENUMS_INSTRUMENTED(Enum, _from_integral_counter,            \
+                                      _from_value(value)));                    \
+}                                                                              \
                                                                                \
-    BETTER_ENUMS_CONSTEXPR_ _integral _to_integral() const;                    \
-    BETTER_ENUMS_IF_EXCEPTIONS(                                                \
-    BETTER_ENUMS_CONSTEXPR_ static Enum _from_integral(_integral value);       \
-    )                                                                          \
-    BETTER_ENUMS_CONSTEXPR_ static Enum                                        \
-    _from_integral_unchecked(_integral value);                                 \
-    BETTER_ENUMS_CONSTEXPR_ static _optional                                   \
-    _from_integral_nothrow(_integral value);                                   \
+BETTER_ENUMS_IF_EXCEPTIONS(                                                    \
+BETTER_ENUMS_CONSTEXPR_ inline Enum Enum::_from_integral(_integral value)      \
+{                                                                              \
+    return                                                                     \
+        ::better_enums::_or_throw(_from_integral_nothrow(value),               \
+                                  #Enum "::_from_integral: invalid argument"); \
+}                                                                              \
+)                                                                              \
                                                                                \
-    BETTER_ENUMS_CONSTEXPR_ std::size_t _to_index() const;                     \
-    BETTER_ENUMS_IF_EXCEPTIONS(                                                \
-    BETTER_ENUMS_CONSTEXPR_ static Enum _from_index(std::size_t value);        \
-    )                                                                          \
-    BETTER_ENUMS_CONSTEXPR_ static Enum                                        \
-    _from_index_unchecked(std::size_t value);                                  \
-    BETTER_ENUMS_CONSTEXPR_ static _optional                                   \
-    _from_index_nothrow(std::size_t value);                                    \
+BETTER_ENUMS_CONSTEXPR_ inline bool Enum::_is_valid(_integral value)           \
+{                                                                              \
+    return _from_value(value);                                                 \
+}                                                                              \
                                                                                \
-    ToStringConstexpr const char* _to_string() const;                          \
-    BETTER_ENUMS_IF_EXCEPTIONS(                                                \
-    BETTER_ENUMS_CONSTEXPR_ static Enum _from_string(const char *name);        \
-    )                                                                          \
-    BETTER_ENUMS_CONSTEXPR_ static _optional                                   \
-    _from_string_nothrow(const char *name);                                    \
                                                                                \
-    BETTER_ENUMS_IF_EXCEPTIONS(                                                \
-    BETTER_ENUMS_CONSTEXPR_ static Enum _from_string_nocase(const char *name); \
-    )                                                                          \
-    BETTER_ENUMS_CONSTEXPR_ static _optional                                   \
-    _from_string_nocase_nothrow(const char *name);                             \
+BETTER_ENUMS_CONSTEXPR_ inline const char* Enum::_name()                       \
+{                                                                              \
+    return #Enum;                                                              \
+}                                                                              \
                                                                                \
-    BETTER_ENUMS_CONSTEXPR_ static bool _is_valid(_integral value);            \
-    BETTER_ENUMS_CONSTEXPR_ static bool _is_valid(const char *name);           \
-    BETTER_ENUMS_CONSTEXPR_ static bool _is_valid_nocase(const char *name);    \
+BETTER_ENUMS_CONSTEXPR_ inline Enum::_value_iterable Enum::_values()           \
+{                                                                              \
+    return _value_iterable(BETTER_ENUMS_NS(Enum)::_value_array, _size());      \
+}                                                                              \
                                                                                \
-    typedef ::better_enums::_iterable<Enum>             _value_iterable;       \
-    typedef ::better_enums::_iterable<const char*>      _name_iterable;        \
+BETTER_ENUMS_CONSTEXPR_ inline ::better_enums::lookup_strategy                 \
+Enum::_value_lookup_strategy()                                                 \
+{                                                                              \
+    return BETTER_ENUMS_VALUE_LOOKUP_STRATEGY(Enum);                           \
+}                                                                              \
                                                                                \
-    typedef _value_iterable::iterator                   _value_iterator;       \
-    typedef _name_iterable::iterator                    _name_iterator;        \
+BETTER_ENUMS_CONSTEXPR_ inline Enum Enum::_min_value()                         \
+{                                                                              \
+    return _from_integral_unchecked(::better_enums::_min_integral<Enum>());    \
+}                                                                              \
                                                                                \
-    BETTER_ENUMS_CONSTEXPR_ static const std::size_t _size_constant =          \
-        BETTER_ENUMS_ID(BETTER_ENUMS_PP_COUNT(__VA_ARGS__));                   \
-    BETTER_ENUMS_CONSTEXPR_ static std::size_t _size()                         \
-        { return _size_constant; }                                             \
+BETTER_ENUMS_CONSTEXPR_ inline Enum Enum::_max_value()                         \
+{                                                                              \
+    return _from_integral_unchecked(::better_enums::_max_integral<Enum>());    \
+}                                                                              \
                                                                                \
-    BETTER_ENUMS_CONSTEXPR_ static const char* _name();                        \
-    BETTER_ENUMS_CONSTEXPR_ static _value_iterable _values();                  \
-    ToStringConstexpr static _name_iterable _names();                          \
+BETTER_ENUMS_CONSTEXPR_ inline bool Enum::_is_contiguous()                     \
+{                                                                              \
+    return ::better_enums::_values_contiguous<Enum>();                         \
+}                                                                              \
                                                                                \
-    _integral      _value;                                                     \
+BETTER_ENUMS_CONSTEXPR_ inline bool Enum::_is_sorted()                         \
+{                                                                              \
+    return ::better_enums::_values_sorted<Enum>();                             \
+}                                                                              \
                                                                                \
-    BETTER_ENUMS_DEFAULT_CONSTRUCTOR(Enum)                                     \
+BETTER_ENUMS_CONSTEXPR_ inline double Enum::_density()                         \
+{                                                                              \
+    return ::better_enums::_values_density<Enum>();                            \
+}                                                                              \
                                                                                \
-  private:                                                                     \
-    explicit BETTER_ENUMS_CONSTEXPR_ Enum(const _integral &value) :            \
-        _value(value) { }                                                      \
+BETTER_ENUMS_CONSTEXPR_ inline Enum::_optional_index                           \
+Enum::_from_value(Enum::_integral value)                                       \
+{                                                                              \
+    return                                                                     \
+        ::better_enums::_value_index<                                          \
+            Enum, BETTER_ENUMS_VALUE_LOOKUP_STRATEGY(Enum)>::find(value);      \
+}                                                                              \
                                                                                \
-    DeclareInitialize                                                          \
+IfNames(                                                                       \
+BETTER_ENUMS_CONSTEXPR_ inline ::better_enums::lookup_strategy                 \
+Enum::_name_lookup_strategy()                                                  \
+{                                                                              \
+    return BETTER_ENUMS_NAME_LOOKUP_STRATEGY;                                  \
+}                                                                              \
+)                                                                              \
                                                                                \
-    BETTER_ENUMS_CONSTEXPR_ static _optional_index                             \
-    _from_value_loop(_integral value, std::size_t index = 0);                  \
-    BETTER_ENUMS_CONSTEXPR_ static _optional_index                             \
-    _from_string_loop(const char *name, std::size_t index = 0);                \
-    BETTER_ENUMS_CONSTEXPR_ static _optional_index                             \
-    _from_string_nocase_loop(const char *name, std::size_t index = 0);         \
+IfNames(BETTER_ENUMS_ID(Names(ToStringConstexpr inline,                        \
+                              NameConstexpr inline,                            \
+                              NameRelaxedConstexpr inline,                     \
+                              inline, GenerateStrings, DefineInitialize,       \
+                              CallInitialize, Enum, __VA_ARGS__)))             \
                                                                                \
-    friend struct ::better_enums::_initialize_at_program_start<Enum>;          \
-};                                                                             \
+BETTER_ENUMS_IGNORE_ATTRIBUTES_HEADER                                          \
+BETTER_ENUMS_IGNORE_ATTRIBUTES_BEGIN                                           \
+BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
+inline bool operator ==(const Enum &a, const Enum &b)                          \
+    { return a._to_integral() == b._to_integral(); }                           \
+                                                                               \
+BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
+inline bool operator !=(const Enum &a, const Enum &b)                          \
+    { return a._to_integral() != b._to_integral(); }                           \
+                                                                               \
+BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
+inline bool operator <(const Enum &a, const Enum &b)                           \
+    { return a._to_integral() < b._to_integral(); }                            \
+                                                                               \
+BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
+inline bool operator <=(const Enum &a, const Enum &b)                          \
+    { return a._to_integral() <= b._to_integral(); }                           \
+                                                                               \
+BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
+inline bool operator >(const Enum &a, const Enum &b)                           \
+    { return a._to_integral() > b._to_integral(); }                            \
+                                                                               \
+BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
+inline bool operator >=(const Enum &a, const Enum &b)                          \
+    { return a._to_integral() >= b._to_integral(); }                           \
+BETTER_ENUMS_IGNORE_ATTRIBUTES_END                                             \
+                                                                               \
+                                                                               \
+IfNames(                                                                       \
+template <typename Char, typename Traits>                                      \
+std::basic_ostream<Char, Traits>&                                              \
+operator <<(std::basic_ostream<Char, Traits>& stream, const Enum &value)       \
+{                                                                              \
+    return stream << value._to_string();                                       \
+}                                                                              \
+                                                                               \
+template <typename Char, typename Traits>                                      \
+std::basic_istream<Char, Traits>&                                              \
+operator >>(std::basic_istream<Char, Traits>& stream, Enum &value)             \
+{                                                                              \
+    return ::better_enums::_read_enum(stream, value);                          \
+}                                                                              \
+)
+
+// Definitions of the members of an enum that deal with names, and of the data
+// behind them. BETTER_ENUMS_TYPE generates them inline, with the rest of the
+// enum. BETTER_ENUM_DEFINE generates them out of line, in one file. The
+// specifiers are those of the definitions: inline, and constexpr where
+// possible, in the first case, and none in the second.
+#define BETTER_ENUMS_NAME_DEFINITIONS(ToStringSpecifiers, Specifiers,          \
+                                      RelaxedSpecifiers, InlineSpecifier,      \
+                                      GenerateStrings, DefineInitialize,       \
+                                      CallInitialize, Enum, ...)               \
                                                                                \
 namespace better_enums_data_ ## Enum {                                         \
                                                                                \
 static ::better_enums::_initialize_at_program_start<Enum>                      \
                                                 _force_initialization;         \
                                                                                \
-enum _putNamesInThisScopeAlso { __VA_ARGS__ };                                 \
+BETTER_ENUMS_ID(GenerateStrings(Enum, __VA_ARGS__))                            \
                                                                                \
-BETTER_ENUMS_IGNORE_OLD_CAST_HEADER                                            \
-BETTER_ENUMS_IGNORE_OLD_CAST_BEGIN                                             \
-BETTER_ENUMS_CONSTEXPR_ const Enum      _value_array[] =                       \
-    { BETTER_ENUMS_ID(BETTER_ENUMS_EAT_ASSIGN(Enum, __VA_ARGS__)) };           \
-BETTER_ENUMS_IGNORE_OLD_CAST_END                                               \
+}                                                                              \
                                                                                \
-BETTER_ENUMS_ID(GenerateStrings(Enum, __VA_ARGS__))                            \
+ToStringSpecifiers const char* Enum::_to_string() const                        \
+{                                                                              \
+    return                                                                     \
+        _name_or_null(                                                         \
+            BETTER_ENUMS_INSTRUMENTED(Enum, _to_string_counter,                \
+                                      _from_value(CallInitialize(_value))));   \
+}                                                                              \
                                                                                \
+ToStringSpecifiers std::size_t Enum::_to_string_length() const                 \
+{                                                                              \
+    return _length_or_zero(_from_value(CallInitialize(_value)));               \
 }                                                                              \
                                                                                \
-BETTER_ENUMS_IGNORE_ATTRIBUTES_HEADER                                          \
-BETTER_ENUMS_IGNORE_ATTRIBUTES_BEGIN                                           \
-BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
-inline const Enum                                                              \
-operator +(Enum::_enumerated enumerated)                                       \
+BETTER_ENUMS_IF_STRING_VIEW(                                                   \
+ToStringSpecifiers std::string_view Enum::_to_string_view() const              \
 {                                                                              \
-    return static_cast<Enum>(enumerated);                                      \
+    return                                                                     \
+        _view_or_empty(                                                        \
+            BETTER_ENUMS_INSTRUMENTED(Enum, _to_string_counter,                \
+                                      _from_value(CallInitialize(_value))));   \
 }                                                                              \
-BETTER_ENUMS_IGNORE_ATTRIBUTES_END                                             \
+)                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline Enum::_optional_index                           \
-Enum::_from_value_loop(Enum::_integral value, std::size_t index)               \
+BETTER_ENUMS_IF_WIDE_NAMES(                                                    \
+RelaxedSpecifiers const wchar_t*                                               \
+Enum::_to_wstring() const                                                      \
+{                                                                              \
+    return ::better_enums::to_basic_string<wchar_t>(*this);                    \
+}                                                                              \
+                                                                               \
+BETTER_ENUMS_IF_EXCEPTIONS(                                                    \
+RelaxedSpecifiers Enum                                                         \
+Enum::_from_wstring(const wchar_t *name)                                       \
 {                                                                              \
     return                                                                     \
-        index == _size() ?                                                     \
-            _optional_index() :                                                \
-            BETTER_ENUMS_NS(Enum)::_value_array[index]._value == value ?       \
-                _optional_index(index) :                                       \
-                _from_value_loop(value, index + 1);                            \
+        ::better_enums::_or_throw(_from_wstring_nothrow(name),                 \
+                                  #Enum "::_from_wstring: invalid argument");  \
+}                                                                              \
+)                                                                              \
+                                                                               \
+RelaxedSpecifiers Enum::_optional                                              \
+Enum::_from_wstring_nothrow(const wchar_t *name)                               \
+{                                                                              \
+    return ::better_enums::from_basic_string_nothrow<Enum>(name);              \
 }                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline Enum::_optional_index                           \
-Enum::_from_string_loop(const char *name, std::size_t index)                   \
+RelaxedSpecifiers Enum::_optional                                              \
+Enum::_from_wstring_nothrow(const wchar_t *name, std::size_t length)           \
+{                                                                              \
+    return ::better_enums::from_basic_string_nothrow<Enum>(name, length);      \
+}                                                                              \
+)                                                                              \
+                                                                               \
+ToStringSpecifiers const char*                                                 \
+Enum::_name_or_null(_optional_index index)                                     \
 {                                                                              \
     return                                                                     \
-        index == _size() ? _optional_index() :                                 \
-        ::better_enums::_names_match(                                          \
-            BETTER_ENUMS_NS(Enum)::_raw_names()[index], name) ?                \
-            _optional_index(index) :                                           \
-            _from_string_loop(name, index + 1);                                \
+        index ? BETTER_ENUMS_NS(Enum)::_name_at(*index) : BETTER_ENUMS_NULLPTR;\
 }                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline Enum::_optional_index                           \
-Enum::_from_string_nocase_loop(const char *name, std::size_t index)            \
+ToStringSpecifiers std::size_t                                                 \
+Enum::_length_or_zero(_optional_index index)                                   \
+{                                                                              \
+    return index ? BETTER_ENUMS_NS(Enum)::_name_length(*index) : 0;            \
+}                                                                              \
+                                                                               \
+BETTER_ENUMS_IF_STRING_VIEW(                                                   \
+ToStringSpecifiers std::string_view                                            \
+Enum::_view_or_empty(_optional_index index)                                    \
 {                                                                              \
     return                                                                     \
-        index == _size() ? _optional_index() :                                 \
-            ::better_enums::_names_match_nocase(                               \
-                BETTER_ENUMS_NS(Enum)::_raw_names()[index], name) ?            \
-                    _optional_index(index) :                                   \
-                    _from_string_nocase_loop(name, index + 1);                 \
+        index ?                                                                \
+            std::string_view(BETTER_ENUMS_NS(Enum)::_name_at(*index),          \
+                             BETTER_ENUMS_NS(Enum)::_name_length(*index)) :    \
+            std::string_view();                                                \
 }                                                                              \
+)                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline Enum::_integral Enum::_to_integral() const      \
+Specifiers Enum::_optional                                                     \
+Enum::_from_string_nothrow(const char *name)                                   \
 {                                                                              \
-    return _integral(_value);                                                  \
+    return                                                                     \
+        ::better_enums::_map_index<Enum>(                                      \
+            BETTER_ENUMS_NS(Enum)::_value_array,                               \
+            BETTER_ENUMS_INSTRUMENTED(Enum, _from_string_counter,              \
+                                      _from_name(name)));                      \
 }                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline std::size_t Enum::_to_index() const             \
+BETTER_ENUMS_IF_EXCEPTIONS(                                                    \
+Specifiers Enum Enum::_from_string(const char *name)                           \
 {                                                                              \
-    return *_from_value_loop(_value);                                          \
+    return                                                                     \
+        ::better_enums::_or_throw(_from_string_nothrow(name),                  \
+                                  #Enum "::_from_string: invalid argument");   \
 }                                                                              \
+)                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline Enum                                            \
-Enum::_from_index_unchecked(std::size_t index)                                 \
+Specifiers Enum::_optional                                                     \
+Enum::_from_string_nocase_nothrow(const char *name)                            \
 {                                                                              \
     return                                                                     \
-        ::better_enums::_or_zero(_from_index_nothrow(index));                  \
+        ::better_enums::_map_index<Enum>(                                      \
+            BETTER_ENUMS_NS(Enum)::_value_array,                               \
+            BETTER_ENUMS_INSTRUMENTED(Enum, _from_string_nocase_counter,       \
+                                      _from_name_nocase(name)));               \
 }                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline Enum::_optional                                 \
-Enum::_from_index_nothrow(std::size_t index)                                   \
+BETTER_ENUMS_IF_EXCEPTIONS(                                                    \
+Specifiers Enum Enum::_from_string_nocase(const char *name)                    \
 {                                                                              \
     return                                                                     \
-        index >= _size() ?                                                     \
-            _optional() :                                                      \
-             _optional(BETTER_ENUMS_NS(Enum)::_value_array[index]);            \
+        ::better_enums::_or_throw(                                             \
+            _from_string_nocase_nothrow(name),                                 \
+            #Enum "::_from_string_nocase: invalid argument");                  \
+}                                                                              \
+)                                                                              \
+                                                                               \
+Specifiers bool Enum::_is_valid(const char *name)                              \
+{                                                                              \
+    return _from_name(name);                                                   \
+}                                                                              \
+                                                                               \
+Specifiers bool Enum::_is_valid_nocase(const char *name)                       \
+{                                                                              \
+    return _from_name_nocase(name);                                            \
+}                                                                              \
+                                                                               \
+Specifiers Enum::_optional                                                     \
+Enum::_from_string_nothrow(const char *name, std::size_t length)               \
+{                                                                              \
+    return                                                                     \
+        ::better_enums::_map_index<Enum>(                                      \
+            BETTER_ENUMS_NS(Enum)::_value_array,                               \
+            BETTER_ENUMS_INSTRUMENTED(Enum, _from_string_counter,              \
+                                      _from_name(name, length)));              \
+}                                                                              \
+                                                                               \
+BETTER_ENUMS_IF_EXCEPTIONS(                                                    \
+Specifiers Enum                                                                \
+Enum::_from_string(const char *name, std::size_t length)                       \
+{                                                                              \
+    return                                                                     \
+        ::better_enums::_or_throw(_from_string_nothrow(name, length),          \
+                                  #Enum "::_from_string: invalid argument");   \
+}                                                                              \
+)                                                                              \
+                                                                               \
+Specifiers Enum::_optional                                                     \
+Enum::_from_string_nocase_nothrow(const char *name, std::size_t length)        \
+{                                                                              \
+    return                                                                     \
+        ::better_enums::_map_index<Enum>(                                      \
+            BETTER_ENUMS_NS(Enum)::_value_array,                               \
+            BETTER_ENUMS_INSTRUMENTED(Enum, _from_string_nocase_counter,       \
+                                      _from_name_nocase(name, length)));       \
+}                                                                              \
+                                                                               \
+BETTER_ENUMS_IF_EXCEPTIONS(                                                    \
+Specifiers Enum                                                                \
+Enum::_from_string_nocase(const char *name, std::size_t length)                \
+{                                                                              \
+    return                                                                     \
+        ::better_enums::_or_throw(                                             \
+            _from_string_nocase_nothrow(name, length),                         \
+            #Enum "::_from_string_nocase: invalid argument");                  \
+}                                                                              \
+)                                                                              \
+                                                                               \
+Specifiers bool                                                                \
+Enum::_is_valid(const char *name, std::size_t length)                          \
+{                                                                              \
+    return _from_name(name, length);                                           \
+}                                                                              \
+                                                                               \
+Specifiers bool                                                                \
+Enum::_is_valid_nocase(const char *name, std::size_t length)                   \
+{                                                                              \
+    return _from_name_nocase(name, length);                                    \
+}                                                                              \
+                                                                               \
+BETTER_ENUMS_IF_STRING_VIEW(                                                   \
+BETTER_ENUMS_IF_EXCEPTIONS(                                                    \
+Specifiers Enum Enum::_from_string(std::string_view name)                      \
+{                                                                              \
+    return _from_string(name.data(), name.size());                             \
 }                                                                              \
                                                                                \
-BETTER_ENUMS_IF_EXCEPTIONS(                                                    \
-BETTER_ENUMS_CONSTEXPR_ inline Enum Enum::_from_index(std::size_t index)       \
+Specifiers Enum                                                                \
+Enum::_from_string_nocase(std::string_view name)                               \
 {                                                                              \
-    return                                                                     \
-        ::better_enums::_or_throw(_from_index_nothrow(index),                  \
-                                  #Enum "::_from_index: invalid argument");    \
+    return _from_string_nocase(name.data(), name.size());                      \
 }                                                                              \
 )                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline Enum                                            \
-Enum::_from_integral_unchecked(_integral value)                                \
+Specifiers Enum::_optional                                                     \
+Enum::_from_string_nothrow(std::string_view name)                              \
 {                                                                              \
-    return static_cast<_enumerated>(value);                                    \
+    return _from_string_nothrow(name.data(), name.size());                     \
 }                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline Enum::_optional                                 \
-Enum::_from_integral_nothrow(_integral value)                                  \
+Specifiers Enum::_optional                                                     \
+Enum::_from_string_nocase_nothrow(std::string_view name)                       \
 {                                                                              \
-    return                                                                     \
-        ::better_enums::_map_index<Enum>(BETTER_ENUMS_NS(Enum)::_value_array,  \
-                                         _from_value_loop(value));             \
+    return _from_string_nocase_nothrow(name.data(), name.size());              \
 }                                                                              \
                                                                                \
-BETTER_ENUMS_IF_EXCEPTIONS(                                                    \
-BETTER_ENUMS_CONSTEXPR_ inline Enum Enum::_from_integral(_integral value)      \
+Specifiers bool Enum::_is_valid(std::string_view name)                         \
 {                                                                              \
-    return                                                                     \
-        ::better_enums::_or_throw(_from_integral_nothrow(value),               \
-                                  #Enum "::_from_integral: invalid argument"); \
+    return _is_valid(name.data(), name.size());                                \
 }                                                                              \
-)                                                                              \
                                                                                \
-ToStringConstexpr inline const char* Enum::_to_string() const                  \
+Specifiers bool                                                                \
+Enum::_is_valid_nocase(std::string_view name)                                  \
 {                                                                              \
-    return                                                                     \
-        ::better_enums::_or_null(                                              \
-            ::better_enums::_map_index<const char*>(                           \
-                BETTER_ENUMS_NS(Enum)::_name_array(),                          \
-                _from_value_loop(CallInitialize(_value))));                    \
+    return _is_valid_nocase(name.data(), name.size());                         \
 }                                                                              \
+)                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline Enum::_optional                                 \
-Enum::_from_string_nothrow(const char *name)                                   \
+Specifiers Enum::_optional_index                                               \
+Enum::_from_name(const char *name)                                             \
 {                                                                              \
     return                                                                     \
-        ::better_enums::_map_index<Enum>(                                      \
-            BETTER_ENUMS_NS(Enum)::_value_array, _from_string_loop(name));     \
+        ::better_enums::_name_index<                                           \
+            Enum, BETTER_ENUMS_NAME_LOOKUP_STRATEGY>::find(name);              \
 }                                                                              \
                                                                                \
-BETTER_ENUMS_IF_EXCEPTIONS(                                                    \
-BETTER_ENUMS_CONSTEXPR_ inline Enum Enum::_from_string(const char *name)       \
+Specifiers Enum::_optional_index                                               \
+Enum::_from_name_nocase(const char *name)                                      \
 {                                                                              \
     return                                                                     \
-        ::better_enums::_or_throw(_from_string_nothrow(name),                  \
-                                  #Enum "::_from_string: invalid argument");   \
+        ::better_enums::_name_index<                                           \
+            Enum, BETTER_ENUMS_NAME_LOOKUP_STRATEGY>::find_nocase(name);       \
 }                                                                              \
-)                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline Enum::_optional                                 \
-Enum::_from_string_nocase_nothrow(const char *name)                            \
+Specifiers Enum::_optional_index                                               \
+Enum::_from_name(const char *name, std::size_t length)                         \
 {                                                                              \
     return                                                                     \
-        ::better_enums::_map_index<Enum>(BETTER_ENUMS_NS(Enum)::_value_array,  \
-                                         _from_string_nocase_loop(name));      \
+        ::better_enums::_name_index<                                           \
+            Enum, BETTER_ENUMS_NAME_LOOKUP_STRATEGY>::find(name, length);      \
 }                                                                              \
                                                                                \
-BETTER_ENUMS_IF_EXCEPTIONS(                                                    \
-BETTER_ENUMS_CONSTEXPR_ inline Enum Enum::_from_string_nocase(const char *name)\
+Specifiers Enum::_optional_index                                               \
+Enum::_from_name_nocase(const char *name, std::size_t length)                  \
 {                                                                              \
     return                                                                     \
-        ::better_enums::_or_throw(                                             \
-            _from_string_nocase_nothrow(name),                                 \
-            #Enum "::_from_string_nocase: invalid argument");                  \
+        ::better_enums::_name_index<                                           \
+            Enum, BETTER_ENUMS_NAME_LOOKUP_STRATEGY>::find_nocase(name,        \
+                                                                  length);     \
 }                                                                              \
-)                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline bool Enum::_is_valid(_integral value)           \
+ToStringSpecifiers Enum::_name_iterable Enum::_names()                         \
 {                                                                              \
-    return _from_value_loop(value);                                            \
+    return                                                                     \
+        _name_iterable(BETTER_ENUMS_NS(Enum)::_name_array(),                   \
+                       CallInitialize(_size()));                               \
 }                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline bool Enum::_is_valid(const char *name)          \
-{                                                                              \
-    return _from_string_loop(name);                                            \
-}                                                                              \
+DefineInitialize(Enum)
+
+// Names of an enum declared with BETTER_ENUM: everything is generated with the
+// rest of the enum.
+#define BETTER_ENUMS_INLINE_NAMES(ToStringSpecifiers, Specifiers,              \
+                                  RelaxedSpecifiers, InlineSpecifier,          \
+                                  GenerateStrings, DefineInitialize,           \
+                                  CallInitialize, Enum, ...)                   \
+                                                                               \
+BETTER_ENUMS_ID(BETTER_ENUMS_NAME_DEFINITIONS(ToStringSpecifiers, Specifiers,  \
+                                              RelaxedSpecifiers,               \
+                                              InlineSpecifier,                 \
+                                              GenerateStrings,                 \
+                                              DefineInitialize,                \
+                                              CallInitialize, Enum,            \
+                                              __VA_ARGS__))                    \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline bool Enum::_is_valid_nocase(const char *name)   \
+BETTER_ENUMS_CONSTEXPR_ inline const char * const * Enum::_raw_names()         \
 {                                                                              \
-    return _from_string_nocase_loop(name);                                     \
+    return BETTER_ENUMS_NS(Enum)::_raw_names();                                \
 }                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline const char* Enum::_name()                       \
+BETTER_ENUMS_CONSTEXPR_ inline const char*                                     \
+Enum::_raw_name(std::size_t index)                                             \
 {                                                                              \
-    return #Enum;                                                              \
+    return BETTER_ENUMS_NS(Enum)::_raw_name(index);                            \
+}
+
+// Names of an enum declared with BETTER_ENUM_DECLARE: only the untrimmed names
+// of the constants, which cost nothing unless they are used. They let templates
+// such as describe and operator >> compute at compile time what they need in
+// every file. The rest is generated by BETTER_ENUM_DEFINE.
+#define BETTER_ENUMS_DECLARED_NAMES(ToStringSpecifiers, Specifiers,            \
+                                    RelaxedSpecifiers, InlineSpecifier,        \
+                                    GenerateStrings, DefineInitialize,         \
+                                    CallInitialize, Enum, ...)                 \
+                                                                               \
+namespace better_enums_data_ ## Enum {                                         \
+                                                                               \
+BETTER_ENUMS_CONSTEXPR_ const char * const    _the_declared_names[] =          \
+    { BETTER_ENUMS_ID(BETTER_ENUMS_STRINGIZE(__VA_ARGS__)) };                  \
+                                                                               \
 }                                                                              \
                                                                                \
-BETTER_ENUMS_CONSTEXPR_ inline Enum::_value_iterable Enum::_values()           \
+BETTER_ENUMS_CONSTEXPR_ inline const char * const * Enum::_raw_names()         \
 {                                                                              \
-    return _value_iterable(BETTER_ENUMS_NS(Enum)::_value_array, _size());      \
+    return BETTER_ENUMS_NS(Enum)::_the_declared_names;                         \
 }                                                                              \
                                                                                \
-ToStringConstexpr inline Enum::_name_iterable Enum::_names()                   \
+BETTER_ENUMS_CONSTEXPR_ inline const char*                                     \
+Enum::_raw_name(std::size_t index)                                             \
 {                                                                              \
-    return                                                                     \
-        _name_iterable(BETTER_ENUMS_NS(Enum)::_name_array(),                   \
-                       CallInitialize(_size()));                               \
-}                                                                              \
+    return BETTER_ENUMS_NS(Enum)::_the_declared_names[index];                  \
+}
+
+
+
+// Enum feature options.
+
+// C++98, C++11
+#define BETTER_ENUMS_CXX98_UNDERLYING_TYPE(Underlying)
+
+// C++11
+#define BETTER_ENUMS_CXX11_UNDERLYING_TYPE(Underlying)                         \
+    : Underlying
+
+#if defined(_MSC_VER) && _MSC_VER >= 1700
+// VS 2012 and above fully support strongly typed enums and will warn about
+// incorrect usage.
+#   define BETTER_ENUMS_LEGACY_UNDERLYING_TYPE(Underlying) \
+        BETTER_ENUMS_CXX11_UNDERLYING_TYPE(Underlying)
+#else
+#   define BETTER_ENUMS_LEGACY_UNDERLYING_TYPE(Underlying) \
+        BETTER_ENUMS_CXX98_UNDERLYING_TYPE(Underlying)
+#endif
+
+// C++98, C++11
+#define BETTER_ENUMS_REGULAR_ENUM_SWITCH_TYPE(Type)                            \
+    _enumerated
+
+// C++11
+#define BETTER_ENUMS_ENUM_CLASS_SWITCH_TYPE(Type)                              \
+    BETTER_ENUMS_NS(Type)::_enumClassForSwitchStatements
+
+// C++98, C++11
+#define BETTER_ENUMS_REGULAR_ENUM_SWITCH_TYPE_GENERATE(Underlying, ...)
+
+// C++11
+#define BETTER_ENUMS_ENUM_CLASS_SWITCH_TYPE_GENERATE(Underlying, ...)          \
+    enum class _enumClassForSwitchStatements : Underlying { __VA_ARGS__ };
+
+// C++98
+#define BETTER_ENUMS_CXX98_TRIM_STRINGS_ARRAYS(Enum, ...)                      \
+    inline const char** _raw_names()                                           \
+    {                                                                          \
+        static const char   *value[] =                                         \
+            { BETTER_ENUMS_ID(BETTER_ENUMS_STRINGIZE(__VA_ARGS__)) };          \
+        return value;                                                          \
+    }                                                                          \
                                                                                \
-DefineInitialize(Enum)                                                         \
+    inline const char* _raw_name(std::size_t index)                            \
+    {                                                                          \
+        return _raw_names()[index];                                            \
+    }                                                                          \
                                                                                \
-BETTER_ENUMS_IGNORE_ATTRIBUTES_HEADER                                          \
-BETTER_ENUMS_IGNORE_ATTRIBUTES_BEGIN                                           \
-BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
-inline bool operator ==(const Enum &a, const Enum &b)                          \
-    { return a._to_integral() == b._to_integral(); }                           \
+    inline char* _name_storage()                                               \
+    {                                                                          \
+        static char         storage[] =                                        \
+            BETTER_ENUMS_ID(BETTER_ENUMS_RESERVE_STORAGE(__VA_ARGS__));        \
+        return storage;                                                        \
+    }                                                                          \
                                                                                \
-BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
-inline bool operator !=(const Enum &a, const Enum &b)                          \
-    { return a._to_integral() != b._to_integral(); }                           \
+    inline const char** _name_array()                                          \
+    {                                                                          \
+        static const char   *value[Enum::_size_constant];                      \
+        return value;                                                          \
+    }                                                                          \
                                                                                \
-BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
-inline bool operator <(const Enum &a, const Enum &b)                           \
-    { return a._to_integral() < b._to_integral(); }                            \
+    inline const char* _name_at(std::size_t index)                             \
+    {                                                                          \
+        return _name_array()[index];                                           \
+    }                                                                          \
                                                                                \
-BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
-inline bool operator <=(const Enum &a, const Enum &b)                          \
-    { return a._to_integral() <= b._to_integral(); }                           \
+    inline std::size_t* _name_lengths()                                        \
+    {                                                                          \
+        static std::size_t  value[Enum::_size_constant];                       \
+        return value;                                                          \
+    }                                                                          \
                                                                                \
-BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
-inline bool operator >(const Enum &a, const Enum &b)                           \
-    { return a._to_integral() > b._to_integral(); }                            \
+    inline std::size_t _name_length(std::size_t index)                         \
+    {                                                                          \
+        return _name_lengths()[index];                                         \
+    }                                                                          \
                                                                                \
-BETTER_ENUMS_UNUSED BETTER_ENUMS_CONSTEXPR_                                    \
-inline bool operator >=(const Enum &a, const Enum &b)                          \
-    { return a._to_integral() >= b._to_integral(); }                           \
-BETTER_ENUMS_IGNORE_ATTRIBUTES_END                                             \
+    inline bool& _initialized()                                                \
+    {                                                                          \
+        static bool         value = false;                                     \
+        return value;                                                          \
+    }
+
+// C++11 fast version
+#define BETTER_ENUMS_CXX11_PARTIAL_CONSTEXPR_TRIM_STRINGS_ARRAYS(Enum, ...)    \
+    constexpr const char    *_the_raw_names[] =                                \
+        { BETTER_ENUMS_ID(BETTER_ENUMS_STRINGIZE(__VA_ARGS__)) };              \
                                                                                \
+    constexpr const char * const * _raw_names()                                \
+    {                                                                          \
+        return _the_raw_names;                                                 \
+    }                                                                          \
                                                                                \
-template <typename Char, typename Traits>                                      \
-std::basic_ostream<Char, Traits>&                                              \
-operator <<(std::basic_ostream<Char, Traits>& stream, const Enum &value)       \
-{                                                                              \
-    return stream << value._to_string();                                       \
-}                                                                              \
+    constexpr const char* _raw_name(std::size_t index)                         \
+    {                                                                          \
+        return _the_raw_names[index];                                          \
+    }                                                                          \
+                                                                               \
+    inline char* _name_storage()                                               \
+    {                                                                          \
+        static char         storage[] =                                        \
+            BETTER_ENUMS_ID(BETTER_ENUMS_RESERVE_STORAGE(__VA_ARGS__));        \
+        return storage;                                                        \
+    }                                                                          \
+                                                                               \
+    inline const char** _name_array()                                          \
+    {                                                                          \
+        static const char   *value[Enum::_size_constant];                      \
+        return value;                                                          \
+    }                                                                          \
+                                                                               \
+    inline const char* _name_at(std::size_t index)                             \
+    {                                                                          \
+        return _name_array()[index];                                           \
+    }                                                                          \
+                                                                               \
+    inline std::size_t* _name_lengths()                                        \
+    {                                                                          \
+        static std::size_t  value[Enum::_size_constant];                       \
+        return value;                                                          \
+    }                                                                          \
+                                                                               \
+    inline std::size_t _name_length(std::size_t index)                         \
+    {                                                                          \
+        return _name_lengths()[index];                                         \
+    }                                                                          \
+
+
+// C++11 slow all-constexpr version
+#define BETTER_ENUMS_CXX11_FULL_CONSTEXPR_TRIM_STRINGS_ARRAYS(Enum, ...)       \
+    BETTER_ENUMS_ID(BETTER_ENUMS_TRIM_STRINGS(__VA_ARGS__))                    \
+                                                                               \
+    constexpr const char * const    _the_name_array[] =                        \
+        { BETTER_ENUMS_ID(BETTER_ENUMS_REFER_TO_STRINGS(__VA_ARGS__)) };       \
+                                                                               \
+    constexpr const char * const * _name_array()                               \
+    {                                                                          \
+        return _the_name_array;                                                \
+    }                                                                          \
+                                                                               \
+    constexpr const char * const * _raw_names()                                \
+    {                                                                          \
+        return _the_name_array;                                                \
+    }                                                                          \
+                                                                               \
+    constexpr const char* _raw_name(std::size_t index)                         \
+    {                                                                          \
+        return _the_name_array[index];                                         \
+    }                                                                          \
+                                                                               \
+    constexpr const char* _name_at(std::size_t index)                          \
+    {                                                                          \
+        return _the_name_array[index];                                         \
+    }                                                                          \
+                                                                               \
+    constexpr std::size_t _name_length(std::size_t index)                      \
+    {                                                                          \
+        return ::better_enums::_name_length<Enum>(index);                      \
+    }
+
+// C++14 relaxed-constexpr version
+#define BETTER_ENUMS_CXX14_CONSTEXPR_TRIM_STRINGS_ARRAYS(Enum, ...)            \
+    constexpr const char    *_the_raw_names[] =                                \
+        { BETTER_ENUMS_ID(BETTER_ENUMS_STRINGIZE(__VA_ARGS__)) };              \
+                                                                               \
+    typedef ::better_enums::_trimmed_names<                                    \
+        ::better_enums::_trimmed_size(_the_raw_names, Enum::_size_constant),   \
+        Enum::_size_constant>                           _trimmed_type;         \
+                                                                               \
+    constexpr _trimmed_type _the_trimmed_names =                               \
+        _trimmed_type::trim(_the_raw_names);                                   \
+                                                                               \
+    template <std::size_t Count>                                               \
+    struct _name_pointer_table {                                               \
+        static constexpr ::better_enums::_name_pointers<Count>  value =        \
+            _trimmed_type::refer(_the_trimmed_names);                          \
+    };                                                                         \
+                                                                               \
+    template <std::size_t Count>                                               \
+    constexpr ::better_enums::_name_pointers<Count>                            \
+        _name_pointer_table<Count>::value;                                     \
+                                                                               \
+    constexpr const char * const * _name_array()                               \
+    {                                                                          \
+        return _name_pointer_table<Enum::_size_constant>::value.pointers;      \
+    }                                                                          \
+                                                                               \
+    constexpr const char * const * _raw_names()                                \
+    {                                                                          \
+        return _name_pointer_table<Enum::_size_constant>::value.pointers;      \
+    }                                                                          \
+                                                                               \
+    constexpr const char* _raw_name(std::size_t index)                         \
+    {                                                                          \
+        return _the_trimmed_names.name(index);                                 \
+    }                                                                          \
+                                                                               \
+    constexpr const char* _name_at(std::size_t index)                          \
+    {                                                                          \
+        return _the_trimmed_names.name(index);                                 \
+    }                                                                          \
+                                                                               \
+    constexpr std::size_t _name_length(std::size_t index)                      \
+    {                                                                          \
+        return _the_trimmed_names.length(index);                               \
+    }
+
+// C++98, C++11 fast version
+#define BETTER_ENUMS_NO_CONSTEXPR_TO_STRING_KEYWORD
+
+// C++11 slow all-constexpr, C++14 relaxed-constexpr versions
+#define BETTER_ENUMS_CONSTEXPR_TO_STRING_KEYWORD                               \
+    constexpr
+
+// C++98, C++11 fast version
+#define BETTER_ENUMS_DO_DECLARE_INITIALIZE                                     \
+    static int initialize();
+
+// C++11 slow all-constexpr, C++14 relaxed-constexpr versions
+#define BETTER_ENUMS_DECLARE_EMPTY_INITIALIZE                                  \
+    static int initialize() { return 0; }
+
+// C++98 version
+#define BETTER_ENUMS_DO_DEFINE_INITIALIZE(Enum)                                \
+    BETTER_ENUMS_COMPACT_NOINLINE inline int Enum::initialize()                \
+    {                                                                          \
+        if (BETTER_ENUMS_NS(Enum)::_initialized())                             \
+            return 0;                                                          \
                                                                                \
-template <typename Char, typename Traits>                                      \
-std::basic_istream<Char, Traits>&                                              \
-operator >>(std::basic_istream<Char, Traits>& stream, Enum &value)             \
-{                                                                              \
-    std::basic_string<Char, Traits>     buffer;                                \
+        ::better_enums::_trim_names(BETTER_ENUMS_NS(Enum)::_raw_names(),       \
+                                    BETTER_ENUMS_NS(Enum)::_name_array(),      \
+                                    BETTER_ENUMS_NS(Enum)::_name_lengths(),    \
+                                    BETTER_ENUMS_NS(Enum)::_name_storage(),    \
+                                    _size());                                  \
                                                                                \
-    stream >> buffer;                                                          \
-    ::better_enums::optional<Enum>      converted =                            \
-        Enum::_from_string_nothrow(buffer.c_str());                            \
+        BETTER_ENUMS_NS(Enum)::_initialized() = true;                          \
                                                                                \
-    if (converted)                                                             \
-        value = *converted;                                                    \
-    else                                                                       \
-        stream.setstate(std::basic_istream<Char, Traits>::failbit);            \
+        return 0;                                                              \
+    }
+
+// C++11 fast version. The names are trimmed while initializing a local static
+// variable, which C++11 guarantees to happen exactly once, even if several
+// threads call initialize() at the same time. After that, each call only checks
+// the guard of the variable.
+#define BETTER_ENUMS_CXX11_DO_DEFINE_INITIALIZE(Enum)                          \
+    BETTER_ENUMS_COMPACT_NOINLINE inline int Enum::initialize()                \
+    {                                                                          \
+        static const int    trimmed =                                          \
+            (::better_enums::_trim_names(                                      \
+                 BETTER_ENUMS_NS(Enum)::_raw_names(),                          \
+                 BETTER_ENUMS_NS(Enum)::_name_array(),                         \
+                 BETTER_ENUMS_NS(Enum)::_name_lengths(),                       \
+                 BETTER_ENUMS_NS(Enum)::_name_storage(), _size()),             \
+             0);                                                               \
                                                                                \
-    return stream;                                                             \
+        return trimmed;                                                        \
+    }
+
+// C++11 slow all-constexpr, C++14 relaxed-constexpr versions
+#define BETTER_ENUMS_DO_NOT_DEFINE_INITIALIZE(Enum)
+
+// C++98, C++11 fast version
+#define BETTER_ENUMS_DO_CALL_INITIALIZE(value)                                 \
+    ::better_enums::continue_with(initialize(), value)
+
+// C++11 slow all-constexpr, C++14 relaxed-constexpr versions
+#define BETTER_ENUMS_DO_NOT_CALL_INITIALIZE(value)                             \
+    value
+
+// Enums with names
+#define BETTER_ENUMS_KEEP_NAMES(...)                                           \
+    __VA_ARGS__
+
+// Values-only enums
+#define BETTER_ENUMS_OMIT_NAMES(...)
+
+// Enums declared with BETTER_ENUM_DECLARE, BETTER_ENUM_DEFINE
+#define BETTER_ENUMS_OUT_OF_LINE
+
+// C++98
+#define BETTER_ENUMS_LINEAR_VALUE_LOOKUP_STRATEGY(Enum)                        \
+    ::better_enums::linear_scan
+
+// C++11
+#define BETTER_ENUMS_SELECT_VALUE_LOOKUP_STRATEGY(Enum)                        \
+    ::better_enums::_select_value_lookup<Enum>()
+
+
+
+// User feature selection.
+
+#ifdef BETTER_ENUMS_STRICT_CONVERSION
+#   define BETTER_ENUMS_DEFAULT_SWITCH_TYPE                                    \
+        BETTER_ENUMS_ENUM_CLASS_SWITCH_TYPE
+#   define BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE                           \
+        BETTER_ENUMS_ENUM_CLASS_SWITCH_TYPE_GENERATE
+#else
+#   define BETTER_ENUMS_DEFAULT_SWITCH_TYPE                                    \
+        BETTER_ENUMS_REGULAR_ENUM_SWITCH_TYPE
+#   define BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE                           \
+        BETTER_ENUMS_REGULAR_ENUM_SWITCH_TYPE_GENERATE
+#endif
+
+
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+#   define BETTER_ENUMS_VALUE_LOOKUP_STRATEGY                                  \
+        BETTER_ENUMS_SELECT_VALUE_LOOKUP_STRATEGY
+#else
+#   define BETTER_ENUMS_VALUE_LOOKUP_STRATEGY                                  \
+        BETTER_ENUMS_LINEAR_VALUE_LOOKUP_STRATEGY
+#endif
+
+#if defined(BETTER_ENUMS_HAVE_CONSTEXPR) && defined(BETTER_ENUMS_HASH_NAMES)
+#   define BETTER_ENUMS_NAME_LOOKUP_STRATEGY    ::better_enums::hash_lookup
+#else
+#   define BETTER_ENUMS_NAME_LOOKUP_STRATEGY    ::better_enums::linear_scan
+#endif
+
+#ifdef BETTER_ENUMS_VALUES_ONLY
+#   define BETTER_ENUMS_DEFAULT_NAMES           BETTER_ENUMS_OMIT_NAMES
+#else
+#   define BETTER_ENUMS_DEFAULT_NAMES           BETTER_ENUMS_KEEP_NAMES
+#endif
+
+
+
+#ifndef BETTER_ENUMS_DEFAULT_CONSTRUCTOR
+#   define BETTER_ENUMS_DEFAULT_CONSTRUCTOR(Enum)                              \
+      private:                                                                 \
+        Enum() : _value(0) { }
+#endif
+
+
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+// In C++14, full-constexpr enums are trimmed by a loop in a constexpr function,
+// which is much cheaper to compile than selecting each character with
+// BETTER_ENUMS_ITERATE, and has no limit on the length of names.
+#ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
+#   define BETTER_ENUMS_FULL_CONSTEXPR_TRIM_STRINGS_ARRAYS                     \
+        BETTER_ENUMS_CXX14_CONSTEXPR_TRIM_STRINGS_ARRAYS
+#else
+#   define BETTER_ENUMS_FULL_CONSTEXPR_TRIM_STRINGS_ARRAYS                     \
+        BETTER_ENUMS_CXX11_FULL_CONSTEXPR_TRIM_STRINGS_ARRAYS
+#endif
+
+#if defined(BETTER_ENUMS_CONSTEXPR_TO_STRING) || \
+    (defined(BETTER_ENUMS_CONSTEXPR_NAMES) && \
+     defined(BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR))
+#   define BETTER_ENUMS_DEFAULT_TRIM_STRINGS_ARRAYS                            \
+        BETTER_ENUMS_FULL_CONSTEXPR_TRIM_STRINGS_ARRAYS
+#   define BETTER_ENUMS_DEFAULT_TO_STRING_KEYWORD                              \
+        BETTER_ENUMS_CONSTEXPR_TO_STRING_KEYWORD
+#   define BETTER_ENUMS_DEFAULT_DECLARE_INITIALIZE                             \
+        BETTER_ENUMS_DECLARE_EMPTY_INITIALIZE
+#   define BETTER_ENUMS_DEFAULT_DEFINE_INITIALIZE                              \
+        BETTER_ENUMS_DO_NOT_DEFINE_INITIALIZE
+#   define BETTER_ENUMS_DEFAULT_CALL_INITIALIZE                                \
+        BETTER_ENUMS_DO_NOT_CALL_INITIALIZE
+#else
+#   define BETTER_ENUMS_DEFAULT_TRIM_STRINGS_ARRAYS                            \
+        BETTER_ENUMS_CXX11_PARTIAL_CONSTEXPR_TRIM_STRINGS_ARRAYS
+#   define BETTER_ENUMS_DEFAULT_TO_STRING_KEYWORD                              \
+        BETTER_ENUMS_NO_CONSTEXPR_TO_STRING_KEYWORD
+#   define BETTER_ENUMS_DEFAULT_DECLARE_INITIALIZE                             \
+        BETTER_ENUMS_DO_DECLARE_INITIALIZE
+#   define BETTER_ENUMS_DEFAULT_DEFINE_INITIALIZE                              \
+        BETTER_ENUMS_CXX11_DO_DEFINE_INITIALIZE
+#   define BETTER_ENUMS_DEFAULT_CALL_INITIALIZE                                \
+        BETTER_ENUMS_DO_CALL_INITIALIZE
+#endif
+
+
+
+// Top-level macros.
+
+#define BETTER_ENUM(Enum, Underlying, ...)                                     \
+    BETTER_ENUMS_ID(BETTER_ENUMS_TYPE(                                         \
+        BETTER_ENUMS_CXX11_UNDERLYING_TYPE,                                    \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE,                                      \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE,                             \
+        BETTER_ENUMS_DEFAULT_NAMES,                                            \
+        BETTER_ENUMS_CONSTEXPR_,                                               \
+        BETTER_ENUMS_RELAXED_CONSTEXPR_,                                       \
+        BETTER_ENUMS_INLINE_NAMES,                                             \
+        BETTER_ENUMS_DEFAULT_TRIM_STRINGS_ARRAYS,                              \
+        BETTER_ENUMS_DEFAULT_TO_STRING_KEYWORD,                                \
+        BETTER_ENUMS_DEFAULT_DECLARE_INITIALIZE,                               \
+        BETTER_ENUMS_DEFAULT_DEFINE_INITIALIZE,                                \
+        BETTER_ENUMS_DEFAULT_CALL_INITIALIZE,                                  \
+        Enum, Underlying, __VA_ARGS__))
+
+#define BETTER_ENUM_VALUES_ONLY(Enum, Underlying, ...)                         \
+    BETTER_ENUMS_ID(BETTER_ENUMS_TYPE(                                         \
+        BETTER_ENUMS_CXX11_UNDERLYING_TYPE,                                    \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE,                                      \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE,                             \
+        BETTER_ENUMS_OMIT_NAMES,                                               \
+        BETTER_ENUMS_CONSTEXPR_,                                               \
+        BETTER_ENUMS_RELAXED_CONSTEXPR_,                                       \
+        BETTER_ENUMS_INLINE_NAMES,                                             \
+        BETTER_ENUMS_DEFAULT_TRIM_STRINGS_ARRAYS,                              \
+        BETTER_ENUMS_DEFAULT_TO_STRING_KEYWORD,                                \
+        BETTER_ENUMS_DEFAULT_DECLARE_INITIALIZE,                               \
+        BETTER_ENUMS_DEFAULT_DEFINE_INITIALIZE,                                \
+        BETTER_ENUMS_DEFAULT_CALL_INITIALIZE,                                  \
+        Enum, Underlying, __VA_ARGS__))
+
+#define BETTER_ENUM_DECLARE(Enum, Underlying, ...)                             \
+    BETTER_ENUMS_ID(BETTER_ENUMS_TYPE(                                         \
+        BETTER_ENUMS_CXX11_UNDERLYING_TYPE,                                    \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE,                                      \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE,                             \
+        BETTER_ENUMS_KEEP_NAMES,                                               \
+        BETTER_ENUMS_OUT_OF_LINE,                                              \
+        BETTER_ENUMS_OUT_OF_LINE,                                              \
+        BETTER_ENUMS_DECLARED_NAMES,                                           \
+        BETTER_ENUMS_DEFAULT_TRIM_STRINGS_ARRAYS,                              \
+        BETTER_ENUMS_NO_CONSTEXPR_TO_STRING_KEYWORD,                           \
+        BETTER_ENUMS_DEFAULT_DECLARE_INITIALIZE,                               \
+        BETTER_ENUMS_DEFAULT_DEFINE_INITIALIZE,                                \
+        BETTER_ENUMS_DEFAULT_CALL_INITIALIZE,                                  \
+        Enum, Underlying, __VA_ARGS__))
+
+#define BETTER_ENUM_DEFINE(Enum, Underlying, ...)                              \
+    BETTER_ENUMS_ID(BETTER_ENUMS_NAME_DEFINITIONS(                             \
+        BETTER_ENUMS_OUT_OF_LINE,                                              \
+        BETTER_ENUMS_OUT_OF_LINE,                                              \
+        BETTER_ENUMS_OUT_OF_LINE,                                              \
+        BETTER_ENUMS_OUT_OF_LINE,                                              \
+        BETTER_ENUMS_DEFAULT_TRIM_STRINGS_ARRAYS,                              \
+        BETTER_ENUMS_DEFAULT_DEFINE_INITIALIZE,                                \
+        BETTER_ENUMS_DEFAULT_CALL_INITIALIZE,                                  \
+        Enum, __VA_ARGS__))
+
+#define SLOW_ENUM(Enum, Underlying, ...)                                       \
+    BETTER_ENUMS_ID(BETTER_ENUMS_TYPE(                                         \
+        BETTER_ENUMS_CXX11_UNDERLYING_TYPE,                                    \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE,                                      \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE,                             \
+        BETTER_ENUMS_KEEP_NAMES,                                               \
+        BETTER_ENUMS_CONSTEXPR_,                                               \
+        BETTER_ENUMS_RELAXED_CONSTEXPR_,                                       \
+        BETTER_ENUMS_INLINE_NAMES,                                             \
+        BETTER_ENUMS_FULL_CONSTEXPR_TRIM_STRINGS_ARRAYS,                       \
+        BETTER_ENUMS_CONSTEXPR_TO_STRING_KEYWORD,                              \
+        BETTER_ENUMS_DECLARE_EMPTY_INITIALIZE,                                 \
+        BETTER_ENUMS_DO_NOT_DEFINE_INITIALIZE,                                 \
+        BETTER_ENUMS_DO_NOT_CALL_INITIALIZE,                                   \
+        Enum, Underlying, __VA_ARGS__))
+
+#else
+
+#define BETTER_ENUM(Enum, Underlying, ...)                                     \
+    BETTER_ENUMS_ID(BETTER_ENUMS_TYPE(                                         \
+        BETTER_ENUMS_LEGACY_UNDERLYING_TYPE,                                   \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE,                                      \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE,                             \
+        BETTER_ENUMS_DEFAULT_NAMES,                                            \
+        BETTER_ENUMS_CONSTEXPR_,                                               \
+        BETTER_ENUMS_RELAXED_CONSTEXPR_,                                       \
+        BETTER_ENUMS_INLINE_NAMES,                                             \
+        BETTER_ENUMS_CXX98_TRIM_STRINGS_ARRAYS,                                \
+        BETTER_ENUMS_NO_CONSTEXPR_TO_STRING_KEYWORD,                           \
+        BETTER_ENUMS_DO_DECLARE_INITIALIZE,                                    \
+        BETTER_ENUMS_DO_DEFINE_INITIALIZE,                                     \
+        BETTER_ENUMS_DO_CALL_INITIALIZE,                                       \
+        Enum, Underlying, __VA_ARGS__))
+
+#define BETTER_ENUM_VALUES_ONLY(Enum, Underlying, ...)                         \
+    BETTER_ENUMS_ID(BETTER_ENUMS_TYPE(                                         \
+        BETTER_ENUMS_LEGACY_UNDERLYING_TYPE,                                   \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE,                                      \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE,                             \
+        BETTER_ENUMS_OMIT_NAMES,                                               \
+        BETTER_ENUMS_CONSTEXPR_,                                               \
+        BETTER_ENUMS_RELAXED_CONSTEXPR_,                                       \
+        BETTER_ENUMS_INLINE_NAMES,                                             \
+        BETTER_ENUMS_CXX98_TRIM_STRINGS_ARRAYS,                                \
+        BETTER_ENUMS_NO_CONSTEXPR_TO_STRING_KEYWORD,                           \
+        BETTER_ENUMS_DO_DECLARE_INITIALIZE,                                    \
+        BETTER_ENUMS_DO_DEFINE_INITIALIZE,                                     \
+        BETTER_ENUMS_DO_CALL_INITIALIZE,                                       \
+        Enum, Underlying, __VA_ARGS__))
+
+#define BETTER_ENUM_DECLARE(Enum, Underlying, ...)                             \
+    BETTER_ENUMS_ID(BETTER_ENUMS_TYPE(                                         \
+        BETTER_ENUMS_LEGACY_UNDERLYING_TYPE,                                   \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE,                                      \
+        BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE,                             \
+        BETTER_ENUMS_KEEP_NAMES,                                               \
+        BETTER_ENUMS_OUT_OF_LINE,                                              \
+        BETTER_ENUMS_OUT_OF_LINE,                                              \
+        BETTER_ENUMS_DECLARED_NAMES,                                           \
+        BETTER_ENUMS_CXX98_TRIM_STRINGS_ARRAYS,                                \
+        BETTER_ENUMS_NO_CONSTEXPR_TO_STRING_KEYWORD,                           \
+        BETTER_ENUMS_DO_DECLARE_INITIALIZE,                                    \
+        BETTER_ENUMS_DO_DEFINE_INITIALIZE,                                     \
+        BETTER_ENUMS_DO_CALL_INITIALIZE,                                       \
+        Enum, Underlying, __VA_ARGS__))
+
+#define BETTER_ENUM_DEFINE(Enum, Underlying, ...)                              \
+    BETTER_ENUMS_ID(BETTER_ENUMS_NAME_DEFINITIONS(                             \
+        BETTER_ENUMS_OUT_OF_LINE,                                              \
+        BETTER_ENUMS_OUT_OF_LINE,                                              \
+        BETTER_ENUMS_OUT_OF_LINE,                                              \
+        BETTER_ENUMS_OUT_OF_LINE,                                              \
+        BETTER_ENUMS_CXX98_TRIM_STRINGS_ARRAYS,                                \
+        BETTER_ENUMS_DO_DEFINE_INITIALIZE,                                     \
+        BETTER_ENUMS_DO_CALL_INITIALIZE,                                       \
+        Enum, __VA_ARGS__))
+
+#endif
+
+
+
+namespace better_enums {
+
+// Maps.
+
+template <typename T>
+struct map_compare {
+    BETTER_ENUMS_CONSTEXPR_ static bool less(const T& a, const T& b)
+        { return a < b; }
+};
+
+template <>
+struct map_compare<const char*> {
+    BETTER_ENUMS_CONSTEXPR_ static bool less(const char *a, const char *b)
+        { return less_loop(a, b); }
+
+  private:
+    BETTER_ENUMS_CONSTEXPR_ static bool
+    less_loop(const char *a, const char *b, size_t index = 0)
+    {
+        return
+            a[index] != b[index] ? a[index] < b[index] :
+            a[index] == '\0' ? false :
+            less_loop(a, b, index + 1);
+    }
+};
+
+template <>
+struct map_compare<const wchar_t*> {
+    BETTER_ENUMS_CONSTEXPR_ static bool less(const wchar_t *a, const wchar_t *b)
+        { return less_loop(a, b); }
+
+  private:
+    BETTER_ENUMS_CONSTEXPR_ static bool
+    less_loop(const wchar_t *a, const wchar_t *b, size_t index = 0)
+    {
+        return
+            a[index] != b[index] ? a[index] < b[index] :
+            a[index] == L'\0' ? false :
+            less_loop(a, b, index + 1);
+    }
+};
+
+template <typename Enum, typename T, typename Compare = map_compare<T> >
+struct map {
+    typedef T (*function)(Enum);
+
+    BETTER_ENUMS_CONSTEXPR_ explicit map(function f) : _f(f) { }
+
+    BETTER_ENUMS_CONSTEXPR_ T from_enum(Enum value) const { return _f(value); }
+    BETTER_ENUMS_CONSTEXPR_ T operator [](Enum value) const
+        { return _f(value); }
+
+    BETTER_ENUMS_CONSTEXPR_ Enum to_enum(T value) const
+    {
+        return
+            _or_throw(to_enum_nothrow(value), "map::to_enum: invalid argument");
+    }
+
+    BETTER_ENUMS_CONSTEXPR_ optional<Enum>
+    to_enum_nothrow(T value, size_t index = 0) const
+    {
+        return
+            index >= Enum::_size() ? optional<Enum>() :
+            Compare::less(_f(Enum::_values()[index]), value) ||
+            Compare::less(value, _f(Enum::_values()[index])) ?
+                to_enum_nothrow(value, index + 1) :
+            Enum::_values()[index];
+    }
+
+  private:
+    const function      _f;
+};
+
+template <typename Enum, typename T>
+BETTER_ENUMS_CONSTEXPR_ map<Enum, T> make_map(T (*f)(Enum))
+{
+    return map<Enum, T>(f);
 }
 
+// A map whose values are computed once, when it is constructed, rather than on
+// each lookup. from_enum reads an array indexed by Enum::_to_index(). to_enum
+// does a binary search over the indices of the constants, sorted by their
+// mapped values. Of several constants mapped to the same value, to_enum returns
+// the first declared, as map::to_enum does.
+template <typename Enum, typename T, typename Compare = map_compare<T> >
+class table_map {
+  public:
+    typedef T (*function)(Enum);
+
+    explicit table_map(function f) : _mapped(), _order()
+    {
+        for (size_t index = 0; index < Enum::_size_constant; ++index) {
+            size_t  slot = index;
 
+            _mapped[index] = f(Enum::_values()[index]);
 
-// Enum feature options.
+            for (; slot > 0 &&
+                   Compare::less(_mapped[index], _mapped[_order[slot - 1]]);
+                 --slot) {
 
-// C++98, C++11
-#define BETTER_ENUMS_CXX98_UNDERLYING_TYPE(Underlying)
+                _order[slot] = _order[slot - 1];
+            }
 
-// C++11
-#define BETTER_ENUMS_CXX11_UNDERLYING_TYPE(Underlying)                         \
-    : Underlying
+            _order[slot] = static_cast<index_type>(index);
+        }
+    }
 
-#if defined(_MSC_VER) && _MSC_VER >= 1700
-// VS 2012 and above fully support strongly typed enums and will warn about
-// incorrect usage.
-#   define BETTER_ENUMS_LEGACY_UNDERLYING_TYPE(Underlying) \
-        BETTER_ENUMS_CXX11_UNDERLYING_TYPE(Underlying)
+    T from_enum(Enum value) const { return _mapped[value._to_index()]; }
+    T operator [](Enum value) const { return _mapped[value._to_index()]; }
+
+    Enum to_enum(T value) const
+    {
+        return
+            _or_throw(to_enum_nothrow(value),
+                      "table_map::to_enum: invalid argument");
+    }
+
+    optional<Enum> to_enum_nothrow(T value) const
+    {
+        size_t  low = 0;
+        size_t  high = Enum::_size_constant;
+
+        while (low < high) {
+            size_t  middle = low + (high - low) / 2;
+
+            if (Compare::less(_mapped[_order[middle]], value))
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        return
+            low < Enum::_size_constant &&
+            !Compare::less(value, _mapped[_order[low]]) ?
+                optional<Enum>(Enum::_values()[_order[low]]) :
+                optional<Enum>();
+    }
+
+  private:
+    typedef typename _compact_index<Enum::_size_constant>::type index_type;
+
+    T               _mapped[Enum::_size_constant];
+    index_type      _order[Enum::_size_constant];
+};
+
+template <typename Enum, typename T>
+table_map<Enum, T> make_table_map(T (*f)(Enum))
+{
+    return table_map<Enum, T>(f);
+}
+
+
+
+// Bulk conversions. Each converts count inputs, and returns the position of the
+// first one that could not be converted, or count if there is none. They are
+// templates, rather than members of each enum, so that only the enums they are
+// used with pay for compiling them.
+
+template <typename Enum>
+inline std::size_t
+to_index_n(const Enum *values, std::size_t count, std::size_t *indices)
+{
+    _value_batch<Enum, BETTER_ENUMS_VALUE_LOOKUP_STRATEGY(Enum)>    batch;
+    std::size_t     first_invalid = count;
+
+    for (std::size_t position = 0; position < count; ++position) {
+        optional<std::size_t>   index = batch.find(values[position]._value);
+
+        indices[position] = index ? *index : Enum::_size_constant;
+        if (!index && first_invalid == count)
+            first_invalid = position;
+    }
+
+    return first_invalid;
+}
+
+template <typename Enum>
+inline std::size_t
+to_string_n(const Enum *values, std::size_t count, const char **names)
+{
+    _value_batch<Enum, BETTER_ENUMS_VALUE_LOOKUP_STRATEGY(Enum)>    batch;
+    std::size_t     first_invalid = count;
+
+    for (std::size_t position = 0; position < count; ++position) {
+        optional<std::size_t>   index =
+            BETTER_ENUMS_INSTRUMENTED(Enum, _to_string_counter,
+                                      batch.find(values[position]._value));
+
+        names[position] = _access<Enum>::name_at(index);
+        if (!index && first_invalid == count)
+            first_invalid = position;
+    }
+
+    return first_invalid;
+}
+
+template <typename Enum>
+inline std::size_t
+from_integral_n(const typename Enum::_integral *integrals, std::size_t count,
+                Enum *values)
+{
+    _value_batch<Enum, BETTER_ENUMS_VALUE_LOOKUP_STRATEGY(Enum)>    batch;
+    std::size_t     first_invalid = count;
+
+    for (std::size_t position = 0; position < count; ++position) {
+        if (BETTER_ENUMS_INSTRUMENTED(Enum, _from_integral_counter,
+                                      batch.find(integrals[position]))) {
+
+            values[position] =
+                Enum::_from_integral_unchecked(integrals[position]);
+        }
+        else if (first_invalid == count)
+            first_invalid = position;
+    }
+
+    return first_invalid;
+}
+
+template <typename Enum>
+inline std::size_t
+from_string_n(const char * const *names, std::size_t count, Enum *values)
+{
+    std::size_t     first_invalid = count;
+
+    for (std::size_t position = 0; position < count; ++position) {
+        optional<Enum>  value = Enum::_from_string_nothrow(names[position]);
+
+        if (value)
+            values[position] = *value;
+        else if (first_invalid == count)
+            first_invalid = position;
+    }
+
+    return first_invalid;
+}
+
+template <typename Enum>
+inline std::size_t
+validate_n(const typename Enum::_integral *integrals, std::size_t count)
+{
+    _value_batch<Enum, BETTER_ENUMS_VALUE_LOOKUP_STRATEGY(Enum)>    batch;
+
+    for (std::size_t position = 0; position < count; ++position) {
+        if (!batch.find(integrals[position]))
+            return position;
+    }
+
+    return count;
+}
+
+template <typename Enum>
+inline std::size_t
+validate_n(const typename Enum::_integral *integrals, std::size_t count,
+           unsigned char *invalid)
+{
+    _value_batch<Enum, BETTER_ENUMS_VALUE_LOOKUP_STRATEGY(Enum)>    batch;
+    std::size_t     first_invalid = count;
+
+    for (std::size_t byte = 0; byte < (count + 7) / 8; ++byte)
+        invalid[byte] = 0;
+
+    for (std::size_t position = 0; position < count; ++position) {
+        if (!batch.find(integrals[position])) {
+            invalid[position / 8] |=
+                static_cast<unsigned char>(1u << (position % 8));
+            if (first_invalid == count)
+                first_invalid = position;
+        }
+    }
+
+    return first_invalid;
+}
+
+
+
+// Visiting.
+
+// The type of the argument passed by better_enums::visit to the visitor. It
+// carries the index of a constant, and the constant itself, in its type, so
+// each can be used where a compile-time constant is required.
+template <typename Enum, size_t Index>
+struct index_constant {
+    BETTER_ENUMS_CONSTEXPR_ static const size_t index = Index;
+
+    BETTER_ENUMS_CONSTEXPR_ static Enum value()
+        { return Enum::_values()[Index]; }
+    BETTER_ENUMS_CONSTEXPR_ operator Enum() const { return value(); }
+};
+
+template <typename Enum, size_t Index>
+BETTER_ENUMS_CONSTEXPR_ const size_t index_constant<Enum, Index>::index;
+
+// Calls visitor(index_constant<Enum, I>()), where I is the index of the given
+// value, and returns the result. The call is made from a switch statement over
+// all the indices, which compilers usually lower to a jump table. The result
+// type must be given explicitly in C++98.
+template <typename Result, typename Enum, typename Visitor>
+inline Result visit(Enum value, Visitor visitor)
+{
+    return _access<Enum>::template visit<Result>(value._to_index(), visitor);
+}
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+template <typename Enum, typename Visitor>
+inline auto visit(Enum value, Visitor visitor) ->
+    decltype(visitor(index_constant<Enum, 0>()))
+{
+    return
+        _access<Enum>::template
+            visit<decltype(visitor(index_constant<Enum, 0>()))>(
+                value._to_index(), visitor);
+}
+
+#endif
+
+
+
+// Containers indexed by Better Enums.
+
+// A fixed-size array with one element for each declared constant, indexed by
+// Enum::_to_index(). It is an aggregate, like std::array, so it can be
+// initialized with a braced list of elements in declaration order, and can be
+// constexpr. Iteration visits the elements in the order of Enum::_values().
+// A constant with the same value as an earlier one has an element, but indexing
+// with it refers to the element of the earlier constant.
+template <typename Enum, typename T>
+struct enum_array {
+    typedef T               value_type;
+    typedef T*              iterator;
+    typedef const T*        const_iterator;
+
+    T& operator [](Enum key) { return _elements[key._to_index()]; }
+    BETTER_ENUMS_CONSTEXPR_ const T& operator [](Enum key) const
+        { return _elements[key._to_index()]; }
+
+    BETTER_ENUMS_CONSTEXPR_ static size_t size()
+        { return Enum::_size_constant; }
+    BETTER_ENUMS_CONSTEXPR_ static Enum key(size_t index)
+        { return Enum::_values()[index]; }
+
+    iterator begin() { return _elements; }
+    iterator end() { return _elements + Enum::_size_constant; }
+    BETTER_ENUMS_CONSTEXPR_ const_iterator begin() const { return _elements; }
+    BETTER_ENUMS_CONSTEXPR_ const_iterator end() const
+        { return _elements + Enum::_size_constant; }
+
+    T* data() { return _elements; }
+    BETTER_ENUMS_CONSTEXPR_ const T* data() const { return _elements; }
+
+    void fill(const T &value)
+    {
+        for (size_t index = 0; index < Enum::_size_constant; ++index)
+            _elements[index] = value;
+    }
+
+    T       _elements[Enum::_size_constant];
+};
+
+// A map from Better Enums to values of type T, stored in an enum_array, with a
+// bitmap of which constants are present. Lookup, insertion, and erasure are a
+// few operations each, and nothing is allocated. Every element is constructed,
+// whether present or not, so T must be default-constructible. Erasing a key
+// assigns T() to its element. Iteration visits the keys that are present, in
+// the order of Enum::_values(); *iterator is the value, and iterator.key() is
+// the key.
+template <typename Enum, typename T>
+class enum_map {
+  public:
+    typedef T               value_type;
+
+    template <typename Map, typename Value>
+    class basic_iterator {
+      public:
+        basic_iterator(Map &map, size_t index) : _map(&map), _index(index)
+            { skip(); }
+
+        Enum key() const { return Enum::_values()[_index]; }
+        Value& value() const { return _map->_elements._elements[_index]; }
+        Value& operator *() const { return value(); }
+        Value* operator ->() const { return &value(); }
+
+        basic_iterator& operator ++() { ++_index; skip(); return *this; }
+        basic_iterator operator ++(int)
+            { basic_iterator copy(*this); ++*this; return copy; }
+
+        bool operator ==(const basic_iterator &other) const
+            { return _index == other._index; }
+        bool operator !=(const basic_iterator &other) const
+            { return _index != other._index; }
+
+      private:
+        void skip()
+        {
+            while (_index < Enum::_size_constant && !_map->occupied(_index))
+                ++_index;
+        }
+
+        Map         *_map;
+        size_t      _index;
+    };
+
+    typedef basic_iterator<enum_map, T>                 iterator;
+    typedef basic_iterator<const enum_map, const T>     const_iterator;
+
+    enum_map() : _elements(), _occupied(), _size(0) { }
+
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+    BETTER_ENUMS_CONSTEXPR_ static size_t max_size()
+        { return Enum::_size_constant; }
+
+    size_t count(Enum key) const { return occupied(key._to_index()) ? 1 : 0; }
+
+    T* find(Enum key)
+    {
+        return
+            occupied(key._to_index()) ? &_elements[key] : BETTER_ENUMS_NULLPTR;
+    }
+
+    const T* find(Enum key) const
+    {
+        return
+            occupied(key._to_index()) ? &_elements[key] : BETTER_ENUMS_NULLPTR;
+    }
+
+    // Inserts a default value if the key is not present.
+    T& operator [](Enum key)
+    {
+        occupy(key._to_index());
+        return _elements[key];
+    }
+
+    // Returns false, and leaves the map unchanged, if the key is present.
+    bool insert(Enum key, const T &value)
+    {
+        if (occupied(key._to_index()))
+            return false;
+
+        occupy(key._to_index());
+        _elements[key] = value;
+
+        return true;
+    }
+
+    size_t erase(Enum key)
+    {
+        size_t  index = key._to_index();
+
+        if (!occupied(index))
+            return 0;
+
+        _occupied[index / 8] &=
+            static_cast<unsigned char>(~(1u << (index % 8)));
+        _elements[key] = T();
+        --_size;
+
+        return 1;
+    }
+
+    void clear()
+    {
+        for (size_t index = 0; index < Enum::_size_constant; ++index)
+            _elements._elements[index] = T();
+        for (size_t byte = 0; byte < sizeof(_occupied); ++byte)
+            _occupied[byte] = 0;
+
+        _size = 0;
+    }
+
+    iterator begin() { return iterator(*this, 0); }
+    iterator end() { return iterator(*this, Enum::_size_constant); }
+    const_iterator begin() const { return const_iterator(*this, 0); }
+    const_iterator end() const
+        { return const_iterator(*this, Enum::_size_constant); }
+
+  private:
+    bool occupied(size_t index) const
+        { return (_occupied[index / 8] & (1u << (index % 8))) != 0; }
+
+    void occupy(size_t index)
+    {
+        if (!occupied(index)) {
+            _occupied[index / 8] |=
+                static_cast<unsigned char>(1u << (index % 8));
+            ++_size;
+        }
+    }
+
+    enum_array<Enum, T> _elements;
+    unsigned char       _occupied[(Enum::_size_constant + 7) / 8];
+    size_t              _size;
+};
+
+// Bit counting for enum_set. GCC and clang provide builtins, which compile to
+// single instructions where the target has them.
+
+BETTER_ENUMS_CONSTEXPR_ inline size_t _popcount(unsigned long word)
+{
+#ifdef __GNUC__
+    return static_cast<size_t>(__builtin_popcountl(word));
 #else
-#   define BETTER_ENUMS_LEGACY_UNDERLYING_TYPE(Underlying) \
-        BETTER_ENUMS_CXX98_UNDERLYING_TYPE(Underlying)
+    return word == 0 ? 0 : 1 + _popcount(word & (word - 1));
 #endif
+}
 
-// C++98, C++11
-#define BETTER_ENUMS_REGULAR_ENUM_SWITCH_TYPE(Type)                            \
-    _enumerated
+// The word must not be zero.
+BETTER_ENUMS_CONSTEXPR_ inline size_t _count_trailing_zeros(unsigned long word)
+{
+#ifdef __GNUC__
+    return static_cast<size_t>(__builtin_ctzl(word));
+#else
+    return (word & 1) != 0 ? 0 : 1 + _count_trailing_zeros(word >> 1);
+#endif
+}
 
-// C++11
-#define BETTER_ENUMS_ENUM_CLASS_SWITCH_TYPE(Type)                              \
-    BETTER_ENUMS_NS(Type)::_enumClassForSwitchStatements
+// A set of Better Enums constants, stored as a bit set with one bit for each
+// declared constant, at position Enum::_to_index(). A constant with the same
+// value as an earlier one shares the earlier constant's bit. Nothing is
+// allocated. size() counts the bits a word at a time, and iteration skips from
+// one member to the next by counting trailing zeros, visiting members in the
+// order of Enum::_values().
+template <typename Enum>
+class enum_set {
+  public:
+    typedef unsigned long   word_type;
+
+    BETTER_ENUMS_CONSTEXPR_ static const size_t word_bits =
+        sizeof(word_type) * 8;
+    BETTER_ENUMS_CONSTEXPR_ static const size_t word_count =
+        (Enum::_size_constant + word_bits - 1) / word_bits;
+
+    class iterator {
+      public:
+        BETTER_ENUMS_CONSTEXPR_ Enum operator *() const
+        {
+            return
+                Enum::_values()[_word * word_bits +
+                                _count_trailing_zeros(_remaining)];
+        }
+
+        BETTER_ENUMS_RELAXED_CONSTEXPR_ iterator& operator ++()
+        {
+            _remaining &= _remaining - 1;
+            advance();
+            return *this;
+        }
+
+        BETTER_ENUMS_RELAXED_CONSTEXPR_ iterator operator ++(int)
+            { iterator copy(*this); ++*this; return copy; }
+
+        BETTER_ENUMS_CONSTEXPR_ bool operator ==(const iterator &other) const
+            { return _word == other._word && _remaining == other._remaining; }
+        BETTER_ENUMS_CONSTEXPR_ bool operator !=(const iterator &other) const
+            { return !(*this == other); }
+
+      private:
+        friend class enum_set;
+
+        BETTER_ENUMS_RELAXED_CONSTEXPR_
+        iterator(const enum_set &set, size_t word) :
+            _set(&set), _word(word),
+            _remaining(word < word_count ? set._words[word] : 0)
+        {
+            advance();
+        }
+
+        BETTER_ENUMS_RELAXED_CONSTEXPR_ void advance()
+        {
+            while (_remaining == 0 && ++_word < word_count)
+                _remaining = _set->_words[_word];
+
+            if (_word > word_count)
+                _word = word_count;
+        }
+
+        const enum_set  *_set;
+        size_t          _word;
+        word_type       _remaining;
+    };
+
+    typedef iterator                                    const_iterator;
+
+    BETTER_ENUMS_CONSTEXPR_ enum_set() : _words() { }
+
+    BETTER_ENUMS_CONSTEXPR_ bool contains(Enum value) const
+        { return (_words[word(value)] & bit(value)) != 0; }
+
+    // Returns false if the value was already in the set.
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ bool insert(Enum value)
+    {
+        bool    inserted = !contains(value);
 
-// C++98, C++11
-#define BETTER_ENUMS_REGULAR_ENUM_SWITCH_TYPE_GENERATE(Underlying, ...)
+        _words[word(value)] |= bit(value);
+        return inserted;
+    }
 
-// C++11
-#define BETTER_ENUMS_ENUM_CLASS_SWITCH_TYPE_GENERATE(Underlying, ...)          \
-    enum class _enumClassForSwitchStatements : Underlying { __VA_ARGS__ };
+    // Returns the number of values removed, zero or one.
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ size_t erase(Enum value)
+    {
+        size_t  erased = contains(value) ? 1 : 0;
 
-// C++98
-#define BETTER_ENUMS_CXX98_TRIM_STRINGS_ARRAYS(Enum, ...)                      \
-    inline const char** _raw_names()                                           \
-    {                                                                          \
-        static const char   *value[] =                                         \
-            { BETTER_ENUMS_ID(BETTER_ENUMS_STRINGIZE(__VA_ARGS__)) };          \
-        return value;                                                          \
-    }                                                                          \
-                                                                               \
-    inline char* _name_storage()                                               \
-    {                                                                          \
-        static char         storage[] =                                        \
-            BETTER_ENUMS_ID(BETTER_ENUMS_RESERVE_STORAGE(__VA_ARGS__));        \
-        return storage;                                                        \
-    }                                                                          \
-                                                                               \
-    inline const char** _name_array()                                          \
-    {                                                                          \
-        static const char   *value[Enum::_size_constant];                      \
-        return value;                                                          \
-    }                                                                          \
-                                                                               \
-    inline bool& _initialized()                                                \
-    {                                                                          \
-        static bool         value = false;                                     \
-        return value;                                                          \
+        _words[word(value)] &= ~bit(value);
+        return erased;
     }
 
-// C++11 fast version
-#define BETTER_ENUMS_CXX11_PARTIAL_CONSTEXPR_TRIM_STRINGS_ARRAYS(Enum, ...)    \
-    constexpr const char    *_the_raw_names[] =                                \
-        { BETTER_ENUMS_ID(BETTER_ENUMS_STRINGIZE(__VA_ARGS__)) };              \
-                                                                               \
-    constexpr const char * const * _raw_names()                                \
-    {                                                                          \
-        return _the_raw_names;                                                 \
-    }                                                                          \
-                                                                               \
-    inline char* _name_storage()                                               \
-    {                                                                          \
-        static char         storage[] =                                        \
-            BETTER_ENUMS_ID(BETTER_ENUMS_RESERVE_STORAGE(__VA_ARGS__));        \
-        return storage;                                                        \
-    }                                                                          \
-                                                                               \
-    inline const char** _name_array()                                          \
-    {                                                                          \
-        static const char   *value[Enum::_size_constant];                      \
-        return value;                                                          \
-    }                                                                          \
-                                                                               \
-    inline bool& _initialized()                                                \
-    {                                                                          \
-        static bool         value = false;                                     \
-        return value;                                                          \
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ void clear()
+    {
+        for (size_t index = 0; index < word_count; ++index)
+            _words[index] = 0;
     }
 
-// C++11 slow all-constexpr version
-#define BETTER_ENUMS_CXX11_FULL_CONSTEXPR_TRIM_STRINGS_ARRAYS(Enum, ...)       \
-    BETTER_ENUMS_ID(BETTER_ENUMS_TRIM_STRINGS(__VA_ARGS__))                    \
-                                                                               \
-    constexpr const char * const    _the_name_array[] =                        \
-        { BETTER_ENUMS_ID(BETTER_ENUMS_REFER_TO_STRINGS(__VA_ARGS__)) };       \
-                                                                               \
-    constexpr const char * const * _name_array()                               \
-    {                                                                          \
-        return _the_name_array;                                                \
-    }                                                                          \
-                                                                               \
-    constexpr const char * const * _raw_names()                                \
-    {                                                                          \
-        return _the_name_array;                                                \
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ size_t size() const
+    {
+        size_t  result = 0;
+
+        for (size_t index = 0; index < word_count; ++index)
+            result += _popcount(_words[index]);
+
+        return result;
     }
 
-// C++98, C++11 fast version
-#define BETTER_ENUMS_NO_CONSTEXPR_TO_STRING_KEYWORD
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ bool empty() const
+    {
+        for (size_t index = 0; index < word_count; ++index) {
+            if (_words[index] != 0)
+                return false;
+        }
 
-// C++11 slow all-constexpr version
-#define BETTER_ENUMS_CONSTEXPR_TO_STRING_KEYWORD                               \
-    constexpr
+        return true;
+    }
 
-// C++98, C++11 fast version
-#define BETTER_ENUMS_DO_DECLARE_INITIALIZE                                     \
-    static int initialize();
+    BETTER_ENUMS_CONSTEXPR_ static size_t max_size()
+        { return Enum::_size_constant; }
 
-// C++11 slow all-constexpr version
-#define BETTER_ENUMS_DECLARE_EMPTY_INITIALIZE                                  \
-    static int initialize() { return 0; }
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ enum_set& operator |=(const enum_set &other)
+    {
+        for (size_t index = 0; index < word_count; ++index)
+            _words[index] |= other._words[index];
 
-// C++98, C++11 fast version
-#define BETTER_ENUMS_DO_DEFINE_INITIALIZE(Enum)                                \
-    inline int Enum::initialize()                                              \
-    {                                                                          \
-        if (BETTER_ENUMS_NS(Enum)::_initialized())                             \
-            return 0;                                                          \
-                                                                               \
-        ::better_enums::_trim_names(BETTER_ENUMS_NS(Enum)::_raw_names(),       \
-                                    BETTER_ENUMS_NS(Enum)::_name_array(),      \
-                                    BETTER_ENUMS_NS(Enum)::_name_storage(),    \
-                                    _size());                                  \
-                                                                               \
-        BETTER_ENUMS_NS(Enum)::_initialized() = true;                          \
-                                                                               \
-        return 0;                                                              \
+        return *this;
     }
 
-// C++11 slow all-constexpr version
-#define BETTER_ENUMS_DO_NOT_DEFINE_INITIALIZE(Enum)
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ enum_set& operator &=(const enum_set &other)
+    {
+        for (size_t index = 0; index < word_count; ++index)
+            _words[index] &= other._words[index];
 
-// C++98, C++11 fast version
-#define BETTER_ENUMS_DO_CALL_INITIALIZE(value)                                 \
-    ::better_enums::continue_with(initialize(), value)
+        return *this;
+    }
 
-// C++11 slow all-constexpr version
-#define BETTER_ENUMS_DO_NOT_CALL_INITIALIZE(value)                             \
-    value
+    // Removes the members of other.
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ enum_set& operator -=(const enum_set &other)
+    {
+        for (size_t index = 0; index < word_count; ++index)
+            _words[index] &= ~other._words[index];
 
+        return *this;
+    }
 
+    BETTER_ENUMS_RELAXED_CONSTEXPR_
+    enum_set operator |(const enum_set &other) const
+        { enum_set result(*this); result |= other; return result; }
 
-// User feature selection.
+    BETTER_ENUMS_RELAXED_CONSTEXPR_
+    enum_set operator &(const enum_set &other) const
+        { enum_set result(*this); result &= other; return result; }
 
-#ifdef BETTER_ENUMS_STRICT_CONVERSION
-#   define BETTER_ENUMS_DEFAULT_SWITCH_TYPE                                    \
-        BETTER_ENUMS_ENUM_CLASS_SWITCH_TYPE
-#   define BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE                           \
-        BETTER_ENUMS_ENUM_CLASS_SWITCH_TYPE_GENERATE
-#else
-#   define BETTER_ENUMS_DEFAULT_SWITCH_TYPE                                    \
-        BETTER_ENUMS_REGULAR_ENUM_SWITCH_TYPE
-#   define BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE                           \
-        BETTER_ENUMS_REGULAR_ENUM_SWITCH_TYPE_GENERATE
-#endif
+    BETTER_ENUMS_RELAXED_CONSTEXPR_
+    enum_set operator -(const enum_set &other) const
+        { enum_set result(*this); result -= other; return result; }
 
+    BETTER_ENUMS_RELAXED_CONSTEXPR_
+    bool operator ==(const enum_set &other) const
+    {
+        for (size_t index = 0; index < word_count; ++index) {
+            if (_words[index] != other._words[index])
+                return false;
+        }
 
+        return true;
+    }
 
-#ifndef BETTER_ENUMS_DEFAULT_CONSTRUCTOR
-#   define BETTER_ENUMS_DEFAULT_CONSTRUCTOR(Enum)                              \
-      private:                                                                 \
-        Enum() : _value(0) { }
-#endif
+    BETTER_ENUMS_RELAXED_CONSTEXPR_
+    bool operator !=(const enum_set &other) const
+        { return !(*this == other); }
 
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ iterator begin() const
+        { return iterator(*this, 0); }
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ iterator end() const
+        { return iterator(*this, word_count); }
 
+  private:
+    BETTER_ENUMS_CONSTEXPR_ static size_t word(Enum value)
+        { return value._to_index() / word_bits; }
+    BETTER_ENUMS_CONSTEXPR_ static word_type bit(Enum value)
+        { return static_cast<word_type>(1) << (value._to_index() % word_bits); }
 
-#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+    word_type   _words[word_count];
+};
 
-#ifdef BETTER_ENUMS_CONSTEXPR_TO_STRING
-#   define BETTER_ENUMS_DEFAULT_TRIM_STRINGS_ARRAYS                            \
-        BETTER_ENUMS_CXX11_FULL_CONSTEXPR_TRIM_STRINGS_ARRAYS
-#   define BETTER_ENUMS_DEFAULT_TO_STRING_KEYWORD                              \
-        BETTER_ENUMS_CONSTEXPR_TO_STRING_KEYWORD
-#   define BETTER_ENUMS_DEFAULT_DECLARE_INITIALIZE                             \
-        BETTER_ENUMS_DECLARE_EMPTY_INITIALIZE
-#   define BETTER_ENUMS_DEFAULT_DEFINE_INITIALIZE                              \
-        BETTER_ENUMS_DO_NOT_DEFINE_INITIALIZE
-#   define BETTER_ENUMS_DEFAULT_CALL_INITIALIZE                                \
-        BETTER_ENUMS_DO_NOT_CALL_INITIALIZE
-#else
-#   define BETTER_ENUMS_DEFAULT_TRIM_STRINGS_ARRAYS                            \
-        BETTER_ENUMS_CXX11_PARTIAL_CONSTEXPR_TRIM_STRINGS_ARRAYS
-#   define BETTER_ENUMS_DEFAULT_TO_STRING_KEYWORD                              \
-        BETTER_ENUMS_NO_CONSTEXPR_TO_STRING_KEYWORD
-#   define BETTER_ENUMS_DEFAULT_DECLARE_INITIALIZE                             \
-        BETTER_ENUMS_DO_DECLARE_INITIALIZE
-#   define BETTER_ENUMS_DEFAULT_DEFINE_INITIALIZE                              \
-        BETTER_ENUMS_DO_DEFINE_INITIALIZE
-#   define BETTER_ENUMS_DEFAULT_CALL_INITIALIZE                                \
-        BETTER_ENUMS_DO_CALL_INITIALIZE
-#endif
 
 
+// Prefix parsing. parse_prefix finds the longest name of a constant that the
+// input begins with, in one pass over the input, without needing the end of a
+// token to be found first, or the input to be terminated.
 
-// Top-level macros.
+// The constants of Enum, in lexicographic order of their names, where a name
+// comes before every longer name that begins with it. The names that begin with
+// any given prefix are then adjacent, so the order can be walked as a trie:
+// each input character narrows the range of candidates by two binary searches.
+// A candidate matches exactly when its name is as long as the input consumed,
+// and such a candidate is always first in the range. In C++14, the order is
+// computed at compile time. Otherwise, it is computed on first use. In C++98,
+// that must not happen in more than one thread at a time.
+template <typename Enum>
+struct _prefix_order {
+    typedef typename _compact_index<Enum::_size_constant>::type     index_type;
 
-#define BETTER_ENUM(Enum, Underlying, ...)                                     \
-    BETTER_ENUMS_ID(BETTER_ENUMS_TYPE(                                         \
-        BETTER_ENUMS_CXX11_UNDERLYING_TYPE,                                    \
-        BETTER_ENUMS_DEFAULT_SWITCH_TYPE,                                      \
-        BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE,                             \
-        BETTER_ENUMS_DEFAULT_TRIM_STRINGS_ARRAYS,                              \
-        BETTER_ENUMS_DEFAULT_TO_STRING_KEYWORD,                                \
-        BETTER_ENUMS_DEFAULT_DECLARE_INITIALIZE,                               \
-        BETTER_ENUMS_DEFAULT_DEFINE_INITIALIZE,                                \
-        BETTER_ENUMS_DEFAULT_CALL_INITIALIZE,                                  \
-        Enum, Underlying, __VA_ARGS__))
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ _prefix_order() : indices(), lengths()
+    {
+        for (std::size_t index = 0; index < Enum::_size_constant; ++index) {
+            std::size_t     slot = index;
 
-#define SLOW_ENUM(Enum, Underlying, ...)                                       \
-    BETTER_ENUMS_ID(BETTER_ENUMS_TYPE(                                         \
-        BETTER_ENUMS_CXX11_UNDERLYING_TYPE,                                    \
-        BETTER_ENUMS_DEFAULT_SWITCH_TYPE,                                      \
-        BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE,                             \
-        BETTER_ENUMS_CXX11_FULL_CONSTEXPR_TRIM_STRINGS_ARRAYS,                 \
-        BETTER_ENUMS_CONSTEXPR_TO_STRING_KEYWORD,                              \
-        BETTER_ENUMS_DECLARE_EMPTY_INITIALIZE,                                 \
-        BETTER_ENUMS_DO_NOT_DEFINE_INITIALIZE,                                 \
-        BETTER_ENUMS_DO_NOT_CALL_INITIALIZE,                                   \
-        Enum, Underlying, __VA_ARGS__))
+            lengths[index] =
+                _constant_length(_access<Enum>::raw_name(index));
 
-#else
+            for (; slot > 0 && _less(index, indices[slot - 1]); --slot)
+                indices[slot] = indices[slot - 1];
 
-#define BETTER_ENUM(Enum, Underlying, ...)                                     \
-    BETTER_ENUMS_ID(BETTER_ENUMS_TYPE(                                         \
-        BETTER_ENUMS_LEGACY_UNDERLYING_TYPE,                                   \
-        BETTER_ENUMS_DEFAULT_SWITCH_TYPE,                                      \
-        BETTER_ENUMS_DEFAULT_SWITCH_TYPE_GENERATE,                             \
-        BETTER_ENUMS_CXX98_TRIM_STRINGS_ARRAYS,                                \
-        BETTER_ENUMS_NO_CONSTEXPR_TO_STRING_KEYWORD,                           \
-        BETTER_ENUMS_DO_DECLARE_INITIALIZE,                                    \
-        BETTER_ENUMS_DO_DEFINE_INITIALIZE,                                     \
-        BETTER_ENUMS_DO_CALL_INITIALIZE,                                       \
-        Enum, Underlying, __VA_ARGS__))
+            indices[slot] = static_cast<index_type>(index);
+        }
+    }
 
-#endif
+    // The character at depth in the name at position in the order, or -1 if
+    // the name is not longer than depth.
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ int
+    character(std::size_t position, std::size_t depth) const
+    {
+        return
+            depth < lengths[indices[position]] ?
+                static_cast<unsigned char>(
+                    _access<Enum>::raw_name(indices[position])[depth]) :
+                -1;
+    }
 
+    index_type      indices[Enum::_size_constant];
+    std::size_t     lengths[Enum::_size_constant];
 
+  private:
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ bool
+    _less(std::size_t left, std::size_t right) const
+    {
+        const char  *left_name = _access<Enum>::raw_name(left);
+        const char  *right_name = _access<Enum>::raw_name(right);
+
+        for (std::size_t depth = 0; ; ++depth) {
+            if (depth == lengths[right])
+                return false;
+            if (depth == lengths[left])
+                return true;
+            if (left_name[depth] != right_name[depth]) {
+                return
+                    static_cast<unsigned char>(left_name[depth]) <
+                    static_cast<unsigned char>(right_name[depth]);
+            }
+        }
+    }
+};
 
-namespace better_enums {
+// A table that is computed once: at compile time in C++14, and on first use
+// otherwise.
+#ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
 
-// Maps.
+template <typename Table>
+struct _table_once {
+    static constexpr const Table& get() { return value; }
 
-template <typename T>
-struct map_compare {
-    BETTER_ENUMS_CONSTEXPR_ static bool less(const T& a, const T& b)
-        { return a < b; }
+    static constexpr Table  value = Table();
 };
 
-template <>
-struct map_compare<const char*> {
-    BETTER_ENUMS_CONSTEXPR_ static bool less(const char *a, const char *b)
-        { return less_loop(a, b); }
+template <typename Table>
+constexpr Table _table_once<Table>::value;
 
-  private:
-    BETTER_ENUMS_CONSTEXPR_ static bool
-    less_loop(const char *a, const char *b, size_t index = 0)
+#else
+
+template <typename Table>
+struct _table_once {
+    static const Table& get()
     {
-        return
-            a[index] != b[index] ? a[index] < b[index] :
-            a[index] == '\0' ? false :
-            less_loop(a, b, index + 1);
+        static const Table  value;
+        return value;
     }
 };
 
-template <>
-struct map_compare<const wchar_t*> {
-    BETTER_ENUMS_CONSTEXPR_ static bool less(const wchar_t *a, const wchar_t *b)
-        { return less_loop(a, b); }
+#endif
 
-  private:
-    BETTER_ENUMS_CONSTEXPR_ static bool
-    less_loop(const wchar_t *a, const wchar_t *b, size_t index = 0)
-    {
-        return
-            a[index] != b[index] ? a[index] < b[index] :
-            a[index] == L'\0' ? false :
-            less_loop(a, b, index + 1);
+// The first position in [low, high) whose character at depth is greater than c,
+// or, if inclusive, not less than c.
+template <typename Enum>
+BETTER_ENUMS_RELAXED_CONSTEXPR_ inline std::size_t
+_prefix_bound(const _prefix_order<Enum> &order, std::size_t low,
+              std::size_t high, std::size_t depth, int c, bool inclusive)
+{
+    while (low < high) {
+        std::size_t middle = low + (high - low) / 2;
+        int         found = order.character(middle, depth);
+
+        if (found < c || (!inclusive && found == c))
+            low = middle + 1;
+        else
+            high = middle;
     }
+
+    return low;
+}
+
+// The result of parse_prefix. length is the length of the matched name, or zero
+// if no name matched.
+template <typename Enum>
+struct prefix_match {
+    optional<Enum>  value;
+    std::size_t     length;
 };
 
-template <typename Enum, typename T, typename Compare = map_compare<T> >
-struct map {
-    typedef T (*function)(Enum);
+// Matches the longest name of a constant that the characters from first to last
+// begin with. Reading stops at the first character that doesn't continue any
+// name. The caller checks whether the match ends a token, for example by
+// looking at the character at first + length. Constexpr in C++14.
+template <typename Enum>
+BETTER_ENUMS_RELAXED_CONSTEXPR_ inline prefix_match<Enum>
+parse_prefix(const char *first, const char *last)
+{
+    const _prefix_order<Enum>   &order =
+        _table_once<_prefix_order<Enum> >::get();
+    std::size_t                 available =
+                                    static_cast<std::size_t>(last - first);
+    std::size_t                 low = 0;
+    std::size_t                 high = Enum::_size_constant;
+    optional<std::size_t>       found;
+    std::size_t                 length = 0;
+
+    for (std::size_t depth = 0; low < high; ++depth) {
+        if (order.character(low, depth) < 0) {
+            found = optional<std::size_t>(order.indices[low]);
+            length = depth;
+            ++low;
+        }
+
+        if (low == high || depth == available)
+            break;
+
+        int     c = static_cast<unsigned char>(first[depth]);
+
+        low = _prefix_bound(order, low, high, depth, c, true);
+        high = _prefix_bound(order, low, high, depth, c, false);
+    }
 
-    BETTER_ENUMS_CONSTEXPR_ explicit map(function f) : _f(f) { }
+    found = BETTER_ENUMS_INSTRUMENTED(Enum, _from_string_counter, found);
 
-    BETTER_ENUMS_CONSTEXPR_ T from_enum(Enum value) const { return _f(value); }
-    BETTER_ENUMS_CONSTEXPR_ T operator [](Enum value) const
-        { return _f(value); }
+    prefix_match<Enum>          result =
+        { found ? optional<Enum>(Enum::_values()[*found]) : optional<Enum>(),
+          length };
+    return result;
+}
 
-    BETTER_ENUMS_CONSTEXPR_ Enum to_enum(T value) const
+
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+// Names in other character types. For each character type that names are
+// requested in, a table of all the names is generated once, by _table_once.
+// Each character of a name is converted through unsigned char, so the names are
+// correct as char8_t, and as wchar_t, char16_t, or char32_t if they are ASCII.
+// Strings of other character types are looked up by narrowing them into a
+// buffer on the stack, which has room for the longest name, and looking up the
+// result as _from_string does, including by hashing if that is enabled.
+
+template <typename Enum>
+constexpr std::size_t _name_storage_in(std::size_t first, std::size_t count)
+{
+    return
+        count == 1 ? _name_length<Enum>(first) + 1 :
+        _name_storage_in<Enum>(first, count / 2) +
+        _name_storage_in<Enum>(first + count / 2, count - count / 2);
+}
+
+template <typename Enum, typename Char>
+struct _char_names {
+    static constexpr std::size_t    size =
+        _name_storage_in<Enum>(0, Enum::_size_constant);
+
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ _char_names() : storage(), offsets()
     {
-        return
-            _or_throw(to_enum_nothrow(value), "map::to_enum: invalid argument");
+        std::size_t     offset = 0;
+
+        for (std::size_t index = 0; index < Enum::_size_constant; ++index) {
+            const char  *name = _access<Enum>::raw_name(index);
+
+            offsets[index] = offset;
+
+            for (std::size_t at = 0; at < _name_length<Enum>(index); ++at) {
+                storage[offset++] =
+                    static_cast<Char>(static_cast<unsigned char>(name[at]));
+            }
+
+            storage[offset++] = Char();
+        }
     }
 
-    BETTER_ENUMS_CONSTEXPR_ optional<Enum>
-    to_enum_nothrow(T value, size_t index = 0) const
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ const Char* name(std::size_t index) const
     {
-        return
-            index >= Enum::_size() ? optional<Enum>() :
-            Compare::less(_f(Enum::_values()[index]), value) ||
-            Compare::less(value, _f(Enum::_values()[index])) ?
-                to_enum_nothrow(value, index + 1) :
-            Enum::_values()[index];
+        return storage + offsets[index];
     }
 
-  private:
-    const function      _f;
+    Char            storage[size];
+    std::size_t     offsets[Enum::_size_constant];
 };
 
-template <typename Enum, typename T>
-BETTER_ENUMS_CONSTEXPR_ map<Enum, T> make_map(T (*f)(Enum))
+// The character c as a narrow character, or '\0', which is in no name, if it
+// has no narrow equivalent.
+template <typename Char>
+BETTER_ENUMS_CONSTEXPR_ inline char _narrow_name_char(Char c)
 {
-    return map<Enum, T>(f);
+    return
+        (Char(-1) < Char(0) && c < Char(0)) ||
+        static_cast<unsigned long>(c) > 0xff ?
+            '\0' : static_cast<char>(static_cast<unsigned char>(c));
+}
+
+// Returns the name of value in Char, or a null pointer if value is not equal to
+// any declared constant. Constexpr in C++14.
+template <typename Char, typename Enum>
+BETTER_ENUMS_RELAXED_CONSTEXPR_ inline const Char* to_basic_string(Enum value)
+{
+    typedef _value_index<Enum, BETTER_ENUMS_VALUE_LOOKUP_STRATEGY(Enum)> index;
+
+    optional<std::size_t>   found = index::find(value._to_integral());
+
+    found = BETTER_ENUMS_INSTRUMENTED(Enum, _to_string_counter, found);
+
+    return
+        found ? _table_once<_char_names<Enum, Char> >::get().name(*found) :
+                BETTER_ENUMS_NULLPTR;
+}
+
+// Looks up a name given in Char. The characters need not be followed by a null
+// character. Constexpr in C++14.
+template <typename Enum, typename Char>
+BETTER_ENUMS_RELAXED_CONSTEXPR_ inline optional<Enum>
+from_basic_string_nothrow(const Char *name, std::size_t length)
+{
+    char    narrowed[_longest_name<Enum>() + 1] = {};
+
+    if (length > _longest_name<Enum>())
+        return optional<Enum>();
+
+    for (std::size_t index = 0; index < length; ++index)
+        narrowed[index] = _narrow_name_char(name[index]);
+
+    return Enum::_from_string_nothrow(narrowed, length);
+}
+
+template <typename Enum, typename Char>
+BETTER_ENUMS_RELAXED_CONSTEXPR_ inline optional<Enum>
+from_basic_string_nothrow(const Char *name)
+{
+    std::size_t length = 0;
+
+    while (length <= _longest_name<Enum>() && name[length] != Char())
+        ++length;
+
+    return from_basic_string_nothrow<Enum>(name, length);
+}
+
+#ifndef BETTER_ENUMS_NO_EXCEPTIONS
+
+template <typename Enum, typename Char>
+BETTER_ENUMS_RELAXED_CONSTEXPR_ inline Enum from_basic_string(const Char *name)
+{
+    return
+        _or_throw(from_basic_string_nothrow<Enum>(name),
+                  "better_enums::from_basic_string: invalid argument");
 }
 
+#endif
+
+#endif // #ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
 }
 
+// Declares the constants of an enum whose names are compared first by
+// _from_string and its variants. The constants are given by name, as in the
+// enum declaration. Use at global scope, after the enum is declared, with the
+// enum's fully qualified name.
+#define BETTER_ENUMS_DECLARE_HOT_CONSTANTS(Enum, ...)                          \
+    namespace better_enums {                                                   \
+    template <>                                                                \
+    struct _hot_constants<Enum> {                                              \
+        BETTER_ENUMS_CONSTEXPR_ static std::size_t count()                     \
+            { return BETTER_ENUMS_PP_COUNT(__VA_ARGS__); }                     \
+        BETTER_ENUMS_CONSTEXPR_ static std::size_t index(std::size_t position) \
+        {                                                                      \
+            return                                                             \
+                BETTER_ENUMS_ID(BETTER_ENUMS_PP_MAP(                           \
+                    BETTER_ENUMS_HOT_CONSTANT_INDEX, Enum, __VA_ARGS__))       \
+                0;                                                             \
+        }                                                                      \
+    };                                                                         \
+    }
+
+#define BETTER_ENUMS_HOT_CONSTANT_INDEX(Enum, index, constant)                 \
+    position == index ? Enum(Enum::constant)._to_index() :
+
 #define BETTER_ENUMS_DECLARE_STD_HASH(type)                                    \
 	namespace std {                                                            \
     template <> struct hash<type>                                              \
@@ -1322,4 +4686,43 @@ BETTER_ENUMS_CONSTEXPR_ map<Enum, T> make_map(T (*f)(Enum))
     };                                                                         \
 	}
 
+// Formatter specializations, which format a Better Enum as its name. Width,
+// fill, and alignment are handled as for strings. Include <format>, or
+// <fmt/format.h>, before using the respective macro, at global scope. The
+// std::format version requires C++20.
+#define BETTER_ENUMS_DECLARE_STD_FORMATTER(type)                               \
+    namespace std {                                                            \
+    template <> struct formatter<type, char> : formatter<string_view, char>    \
+    {                                                                          \
+        template <typename FormatContext>                                      \
+        typename FormatContext::iterator                                       \
+        format(const type &x, FormatContext &context) const                    \
+        {                                                                      \
+            return                                                             \
+                formatter<string_view, char>::format(                          \
+                    x._to_string_view(), context);                             \
+        }                                                                      \
+    };                                                                         \
+    }
+
+#define BETTER_ENUMS_DECLARE_FMT_FORMATTER(type)                               \
+    namespace fmt {                                                            \
+    template <> struct formatter<type, char> : formatter<string_view, char>    \
+    {                                                                          \
+        template <typename FormatContext>                                      \
+        typename FormatContext::iterator                                       \
+        format(const type &x, FormatContext &context) const                    \
+        {                                                                      \
+            std::size_t length = 0;                                            \
+            const char  *name =                                                \
+                ::better_enums::_access<type>::name(x, length);                \
+                                                                               \
+            return                                                             \
+                formatter<string_view, char>::format(                          \
+                    name ? string_view(name, length) : string_view(),          \
+                    context);                                                  \
+        }                                                                      \
+    };                                                                         \
+    }
+
 #endif // #ifndef BETTER_ENUMS_ENUM_H
@@ -61,3 +61,17 @@ int main()
 //
 // static_assert(max<EFLAGS>()._to_integral() < 32,
 //               "some bit indices are out of range");
+//
+// If the numeric values of the constants don't matter as bit indices, and you
+// just want a set of constants, use better_enums::enum_set instead. It has one
+// bit for each declared constant, rather than one for each integer up to the
+// largest value, so it stays small even when the values are sparse. It also
+// supports iteration over its members:
+//
+// better_enums::enum_set<EFLAGS>  flags;
+// flags.insert(EFLAGS::Carry);
+// flags.insert(EFLAGS::CPUIDPresent);
+//
+// for (EFLAGS flag : flags)
+//     std::cout << flag << std::endl;
+
@@ -70,5 +70,18 @@ int main()
 //
 // Compare has to be a class with a static member function bool less(const T&,
 // const T&). The default implementation better_enums::map_compare simply
-// applies operator <, except when T is const char*. In that case, it does
-// lexicographic comparison.
+// applies operator <, except when T is const char* or const wchar_t*. In that
+// case, it does lexicographic comparison.
+//
+// Each lookup in a better_enums::map calls the function, and to_enum calls it
+// for each constant in turn. If you look up values often, and the map doesn't
+// have to be constexpr, use better_enums::make_table_map instead:
+//
+// static const better_enums::table_map<Channel, const char*>
+//     table = better_enums::make_table_map(describe);
+//
+// When it is constructed, a better_enums::table_map calls the function once for
+// each constant, and stores the results. After that, from_enum reads an array,
+// and to_enum does a binary search over the stored results, sorted with
+// Compare.
+
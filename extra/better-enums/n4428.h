@@ -43,6 +43,15 @@ struct enum_traits {
             static const char* identifier() { return Enum::_names()[Index]; };
         };
     };
+
+    // These are not part of N4428. They give the range of the declared values,
+    // and how densely the constants fill it, which Better Enums computes once
+    // for each enum. See Enum::_min_value() and the following methods.
+    constexpr static Enum       min_value = Enum::_min_value();
+    constexpr static Enum       max_value = Enum::_max_value();
+    constexpr static bool       is_contiguous = Enum::_is_contiguous();
+    constexpr static bool       is_sorted = Enum::_is_sorted();
+    constexpr static double     density = Enum::_density();
 };
 
 }
@@ -0,0 +1,931 @@
+// This file is part of Better Enums, released under the BSD 2-clause license.
+// See doc/LICENSE for details, or visit http://github.com/aantron/better-enums.
+
+// This file provides descriptors, which describe Better Enums in a type that is
+// not a template, the descriptor registry, binary serialization of indices, and
+// schema export and import, for exchanging enums with other processes and
+// builds. It is included after enum.h. The registry additionally requires
+// BETTER_ENUMS_REGISTRY to be defined before enum.h is included.
+
+// See the Descriptors, Binary serialization, and Schema export sections of
+// doc/ApiReference.md, or visit:
+//     http://aantron.github.io/better-enums/ApiReference.html
+
+#pragma once
+
+#ifndef BETTER_ENUMS_SCHEMA_H
+#define BETTER_ENUMS_SCHEMA_H
+
+
+
+namespace better_enums {
+
+// Descriptors.
+
+// A description of a Better Enum that is not a template, so that code handling
+// many enum types, such as a serialization layer, can be written once against
+// descriptors, instead of being instantiated for each type. A descriptor is
+// obtained with better_enums::describe<Enum>(), and is constexpr in C++11.
+//
+// The values are those of Enum::_values(), converted to integral. integral is
+// long long, which has at least 64 bits, in C++11. C++98 has no 64-bit type, so
+// there it is long, which has at least 32 bits: 32 on Windows, and 64 on most
+// other 64-bit platforms. Values of an underlying type wider than long don't
+// round-trip through a descriptor in C++98. The raw names are the constant
+// strings as declared, possibly followed by an initializer. The names function
+// returns the same array as Enum::_names(). It is a function because, unless
+// names are computed at compile time, the array is filled in when it is first
+// requested. All lookups go through the same name scans as compact mode, so
+// their code is shared by all enums.
+struct descriptor {
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+    typedef long long       integral;
+#else
+    typedef long            integral;
+#endif
+
+    BETTER_ENUMS_CONSTEXPR_ descriptor(const char *type_name_,
+                                       std::size_t size_,
+                                       const integral *values_,
+                                       const char * const *raw_names_,
+                                       const char * const* (*names_)()) :
+        type_name(type_name_), size(size_), values(values_),
+        raw_names(raw_names_), names(names_) { }
+
+    const char              *type_name;
+    std::size_t             size;
+    const integral          *values;
+    const char * const      *raw_names;
+    const char * const*     (*names)();
+
+    BETTER_ENUMS_CONSTEXPR_ integral value(std::size_t index) const
+        { return values[index]; }
+    const char* name(std::size_t index) const { return names()[index]; }
+
+    BETTER_ENUMS_CONSTEXPR_ optional<std::size_t>
+    index_of_value(integral integral_value) const
+        { return _descriptor_value_scan(values, size, integral_value); }
+    BETTER_ENUMS_CONSTEXPR_ optional<std::size_t>
+    index_of_name(const char *name) const
+        { return _descriptor_scan(_descriptor(raw_names, size), name); }
+    BETTER_ENUMS_CONSTEXPR_ optional<std::size_t>
+    index_of_name_nocase(const char *name) const
+        { return _descriptor_scan_nocase(_descriptor(raw_names, size), name); }
+
+    // Returns the name of the first constant with the given value, or a null
+    // pointer if there is none.
+    const char* to_string(integral integral_value) const
+    {
+        optional<std::size_t>   index = index_of_value(integral_value);
+        return index ? name(*index) : BETTER_ENUMS_NULLPTR;
+    }
+
+  private:
+    BETTER_ENUMS_CONSTEXPR_ static optional<std::size_t>
+    _descriptor_value_scan(const integral *values, std::size_t size,
+                           integral integral_value, std::size_t index = 0)
+    {
+        return
+            index == size ? optional<std::size_t>() :
+            values[index] == integral_value ? optional<std::size_t>(index) :
+            _descriptor_value_scan(values, size, integral_value, index + 1);
+    }
+};
+
+template <typename Enum>
+inline const char * const* _descriptor_names()
+{
+    return Enum::_names().begin();
+}
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+template <typename Enum,
+          typename = typename _make_index_sequence<Enum::_size_constant>::type>
+struct _descriptor_values;
+
+template <typename Enum, std::size_t... Indices>
+struct _descriptor_values<Enum, _index_sequence<Indices...> > {
+    constexpr static const descriptor::integral *get() { return values; }
+
+    constexpr static const descriptor::integral values[] =
+        { static_cast<descriptor::integral>(
+              Enum::_values()[Indices]._to_integral())... };
+};
+
+template <typename Enum, std::size_t... Indices>
+constexpr const descriptor::integral
+_descriptor_values<Enum, _index_sequence<Indices...> >::values[];
+
+#else
+
+template <typename Enum>
+struct _descriptor_values {
+    static const descriptor::integral* get()
+    {
+        static descriptor::integral values[Enum::_size_constant];
+        static const bool           filled = fill(values);
+
+        (void)filled;
+        return values;
+    }
+
+    static bool fill(descriptor::integral *values)
+    {
+        for (std::size_t index = 0; index < Enum::_size_constant; ++index) {
+            values[index] =
+                static_cast<descriptor::integral>(
+                    Enum::_values()[index]._to_integral());
+        }
+
+        return true;
+    }
+};
+
+#endif
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline descriptor describe()
+{
+    return
+        descriptor(Enum::_name(), Enum::_size_constant,
+                   _descriptor_values<Enum>::get(),
+                   _access<Enum>::raw_names(), &_descriptor_names<Enum>);
+}
+
+// The registry of descriptors, for finding enums by type name at run time. It
+// is an intrusive list of one node for each registered enum, so registration
+// doesn't allocate. In C++11, enums can be registered from any thread, while
+// other threads call find_descriptor. In C++98, registration is not
+// synchronized, and should be done before other threads call find_descriptor,
+// for example during static initialization. The registry is enabled by defining
+// BETTER_ENUMS_REGISTRY before including enum.h.
+
+#ifdef BETTER_ENUMS_REGISTRY
+
+struct _registry_node {
+    const char              *type_name;
+    descriptor              value;
+    _registry_node          *next;
+};
+
+inline _list_head<_registry_node>::type& _registry_head()
+{
+    static _list_head<_registry_node>::type     head(BETTER_ENUMS_NULLPTR);
+    return head;
+}
+
+inline _registry_node& _registry_push(_registry_node &node)
+{
+    _list_push(_registry_head(), node);
+    return node;
+}
+
+// Adds the descriptor of Enum to the registry under the given type name, if
+// the enum is not already registered, and returns the descriptor. Enums in
+// different namespaces can have the same Enum::_name(), so a program that has
+// such enums should register them under qualified names, such as "a::Color".
+// An enum is registered once, under the name given the first time. To register
+// an enum during static initialization, use the result to initialize a
+// namespace-scope variable.
+template <typename Enum>
+inline const descriptor& register_enum(const char *type_name)
+{
+    static _registry_node   node =
+        { type_name, describe<Enum>(), BETTER_ENUMS_NULLPTR };
+    static _registry_node   &registered = _registry_push(node);
+
+    return registered.value;
+}
+
+// Registers Enum under Enum::_name().
+template <typename Enum>
+inline const descriptor& register_enum()
+{
+    return register_enum<Enum>(Enum::_name());
+}
+
+// Returns the number of enums registered under the given type name. It is more
+// than one if different enums were registered under the same name.
+inline std::size_t count_descriptors(const char *type_name)
+{
+    std::size_t     count = 0;
+
+    for (const _registry_node *node = _list_first(_registry_head());
+         node != BETTER_ENUMS_NULLPTR; node = node->next) {
+
+        if (std::strcmp(node->type_name, type_name) == 0)
+            ++count;
+    }
+
+    return count;
+}
+
+// Returns the descriptor of the enum registered under the given type name, or a
+// null pointer if there is none, or if more than one enum is registered under
+// that name. count_descriptors tells the last two cases apart.
+inline const descriptor* find_descriptor(const char *type_name)
+{
+    const descriptor    *found = BETTER_ENUMS_NULLPTR;
+
+    for (const _registry_node *node = _list_first(_registry_head());
+         node != BETTER_ENUMS_NULLPTR; node = node->next) {
+
+        if (std::strcmp(node->type_name, type_name) == 0) {
+            if (found != BETTER_ENUMS_NULLPTR)
+                return BETTER_ENUMS_NULLPTR;
+
+            found = &node->value;
+        }
+    }
+
+    return found;
+}
+
+#endif // #ifdef BETTER_ENUMS_REGISTRY
+
+// Binary serialization.
+
+// An enum is serialized as its index, Enum::_to_index(), stored in the smallest
+// unsigned type that can hold every index: one byte for enums with up to 256
+// constants. Indices wider than one byte are stored in the byte order of the
+// host, so that a column of them can be read in place, for example from a
+// mapped file.
+template <typename Enum>
+struct serialized_index {
+    typedef typename _select_type<(Enum::_size_constant <= 0x100),
+                                  unsigned char,
+            typename _select_type<(Enum::_size_constant <= 0x10000),
+                                  unsigned short, unsigned int>::type>::type
+                                                                    type;
+};
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline typename serialized_index<Enum>::type
+encode_index(Enum value)
+{
+    return
+        static_cast<typename serialized_index<Enum>::type>(value._to_index());
+}
+
+// Returns the constant with the given index, or an empty optional if the index
+// is out of range.
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline optional<Enum> decode_index(std::size_t index)
+{
+    return
+        index < Enum::_size_constant ?
+            optional<Enum>(Enum::_values()[index]) : optional<Enum>();
+}
+
+// For indices that have already been checked, for example by validate_indices.
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline Enum decode_index_unchecked(std::size_t index)
+{
+    return Enum::_values()[index];
+}
+
+// Returns the position of the first index that is out of range, or count if
+// all are valid. The indices are checked a block at a time, without branching
+// inside a block, so that compilers can vectorize the check.
+template <typename Enum>
+inline std::size_t
+validate_indices(const typename serialized_index<Enum>::type *indices,
+                 std::size_t count)
+{
+    const std::size_t   block = 64;
+    const std::size_t   size = Enum::_size_constant;
+    std::size_t         position = 0;
+
+    for (; position + block <= count; position += block) {
+        bool    invalid = false;
+
+        for (std::size_t offset = 0; offset < block; ++offset) {
+            invalid |=
+                static_cast<std::size_t>(indices[position + offset]) >= size;
+        }
+
+        if (invalid)
+            break;
+    }
+
+    for (; position < count; ++position) {
+        if (static_cast<std::size_t>(indices[position]) >= size)
+            return position;
+    }
+
+    return count;
+}
+
+// The schema fingerprint is a 32-bit FNV-1a hash over each constant, in
+// declaration order, of its name, followed by a zero byte, followed by its
+// value as the eight bytes, least significant first, of a 64-bit
+// two's-complement integer. It is the same in every language mode and on every
+// platform, so a writer can store it next to the indices, and a reader can
+// check that it agrees on the meaning of each index.
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+typedef unsigned long long  _fingerprint_wide;
+#else
+typedef unsigned long       _fingerprint_wide;
+#endif
+
+BETTER_ENUMS_CONSTEXPR_ inline unsigned int
+_fingerprint_byte(unsigned int hash, _fingerprint_wide byte)
+{
+    return (hash ^ static_cast<unsigned int>(byte & 0xff)) * 16777619u;
+}
+
+BETTER_ENUMS_CONSTEXPR_ inline unsigned int
+_fingerprint_word(unsigned int hash, _fingerprint_wide word)
+{
+    return
+        _fingerprint_byte(
+            _fingerprint_byte(
+                _fingerprint_byte(_fingerprint_byte(hash, word), word >> 8),
+                word >> 16),
+            word >> 24);
+}
+
+BETTER_ENUMS_CONSTEXPR_ inline unsigned int
+_fingerprint_name(unsigned int hash, const char *name, std::size_t index = 0)
+{
+    return
+        _ends_name(name[index]) ? _fingerprint_byte(hash, 0) :
+        _fingerprint_name(
+            _fingerprint_byte(hash, static_cast<unsigned char>(name[index])),
+            name, index + 1);
+}
+
+// The high word is taken from the value itself if the wide type has more than
+// 32 bits. Otherwise, it is the sign extension of the low word, which, because
+// the value was converted from a type with at most 32 bits, is all ones exactly
+// when the value is negative.
+template <typename Integral>
+BETTER_ENUMS_CONSTEXPR_ inline unsigned int
+_fingerprint_value(unsigned int hash, Integral value)
+{
+    return
+        _fingerprint_word(
+            _fingerprint_word(hash, static_cast<_fingerprint_wide>(value)),
+            sizeof(_fingerprint_wide) > 4 ?
+                static_cast<_fingerprint_wide>(value) >> 16 >> 16 :
+            Integral(-1) < Integral(0) &&
+            (static_cast<_fingerprint_wide>(value) >> 31) != 0 ?
+                0xffffffffu : 0);
+}
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline unsigned int
+_fingerprint_constants(unsigned int hash, std::size_t index = 0)
+{
+    return
+        index == Enum::_size_constant ? hash :
+        _fingerprint_constants<Enum>(
+            _fingerprint_value(
+                _fingerprint_name(hash, _access<Enum>::raw_name(index)),
+                Enum::_values()[index]._to_integral()),
+            index + 1);
+}
+
+template <typename Enum>
+BETTER_ENUMS_CONSTEXPR_ inline unsigned int schema_fingerprint()
+{
+    return _fingerprint_constants<Enum>(2166136261u);
+}
+
+
+
+// Schema export.
+
+// The schema of an enum is a text description of its constants, for passing to
+// other processes, and other builds of the same program. For example, for
+//
+//     BETTER_ENUM(Channel, unsigned char, Red, Green = 4, Blue)
+//
+// the schema is
+//
+//     Channel
+//     uint8
+//     3 560ee48e
+//     Red 0
+//     Green 4
+//     Blue 5
+//
+// where the first line is the type name, the second is the underlying type, as
+// int or uint followed by its size in bits, and the third is the number of
+// constants, and the schema fingerprint in hexadecimal. Each constant follows,
+// on its own line, in declaration order, with its value in decimal. Each line,
+// including the last, ends with a newline. Aliases are included, so the order
+// of the lines is the order of _names().
+
+// The output of write_schema. Characters beyond the end of the buffer are only
+// counted, as with snprintf, so that the whole length can be found by writing
+// into an empty buffer.
+class _schema_output {
+  public:
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ _schema_output(char *buffer,
+                                                   std::size_t size) :
+        _buffer(buffer), _size(size), _length(0) { }
+
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ void put(char c)
+    {
+        if (_length + 1 < _size)
+            _buffer[_length] = c;
+        ++_length;
+    }
+
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ void name(const char *raw_name)
+    {
+        for (std::size_t index = 0; !_ends_name(raw_name[index]); ++index)
+            put(raw_name[index]);
+    }
+
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ void decimal(_fingerprint_wide number)
+    {
+        char            digits[24] = {};
+        std::size_t     count = 0;
+
+        do {
+            digits[count++] = static_cast<char>('0' + number % 10);
+            number /= 10;
+        } while (number != 0);
+
+        while (count > 0)
+            put(digits[--count]);
+    }
+
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ void hexadecimal(unsigned int number)
+    {
+        for (int shift = 28; shift >= 0; shift -= 4)
+            put("0123456789abcdef"[(number >> shift) & 0xf]);
+    }
+
+    // Negative values are written as a minus sign and the magnitude, which is
+    // computed with wrap-around in the wide unsigned type.
+    template <typename Integral>
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ void value(Integral number)
+    {
+        _fingerprint_wide   bits = static_cast<_fingerprint_wide>(number);
+
+        if (Integral(-1) < Integral(0) && number < Integral(0)) {
+            put('-');
+            decimal(_fingerprint_wide(0) - bits);
+        }
+        else
+            decimal(bits);
+    }
+
+    template <typename Integral>
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ void type()
+    {
+        if (!(Integral(-1) < Integral(0)))
+            put('u');
+        put('i');
+        put('n');
+        put('t');
+        decimal(sizeof(Integral) * 8);
+    }
+
+    BETTER_ENUMS_RELAXED_CONSTEXPR_ std::size_t finish()
+    {
+        if (_size > 0)
+            _buffer[_length < _size ? _length : _size - 1] = '\0';
+        return _length;
+    }
+
+  private:
+    char            *_buffer;
+    std::size_t     _size;
+    std::size_t     _length;
+};
+
+// Writes the schema of Enum into the buffer, truncated to size - 1 characters
+// and terminated with a null character, unless size is zero. Returns the length
+// of the whole schema, not counting the null character. The buffer may be null
+// if size is zero. This is constexpr in C++14.
+template <typename Enum>
+BETTER_ENUMS_RELAXED_CONSTEXPR_ inline std::size_t
+write_schema(char *buffer, std::size_t size)
+{
+    _schema_output  output(buffer, size);
+
+    output.name(Enum::_name());
+    output.put('\n');
+    output.template type<typename Enum::_integral>();
+    output.put('\n');
+    output.decimal(Enum::_size_constant);
+    output.put(' ');
+    output.hexadecimal(schema_fingerprint<Enum>());
+    output.put('\n');
+
+    for (std::size_t index = 0; index < Enum::_size_constant; ++index) {
+        output.name(_access<Enum>::raw_name(index));
+        output.put(' ');
+        output.value(Enum::_values()[index]._to_integral());
+        output.put('\n');
+    }
+
+    return output.finish();
+}
+
+#ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
+
+// The schema of Enum, generated at compile time.
+template <typename Enum>
+class schema_text {
+  public:
+    constexpr schema_text() : _text() { write_schema<Enum>(_text, capacity); }
+
+    constexpr const char* c_str() const { return _text; }
+    constexpr std::size_t size() const { return capacity - 1; }
+
+  private:
+    static constexpr std::size_t    capacity =
+        write_schema<Enum>(BETTER_ENUMS_NULLPTR, 0) + 1;
+
+    char        _text[capacity];
+};
+
+#endif
+
+
+
+// Remapping of values from another schema. A peer that was built with a
+// different version of an enum sends its values, which are translated into the
+// local constants with the same names. The translation is a lookup in a table
+// indexed by the distance of the peer value from the smallest peer value, if
+// the peer values span a range narrower than _schema_dense_limit(count).
+// Otherwise, it is a binary search over the sorted peer values.
+
+// The input of schema_remap::load. Each read function returns false, and
+// leaves the input unchanged, if the expected token is not there.
+struct _schema_input {
+    explicit _schema_input(const char *text_) : text(text_) { }
+
+    bool line(const char *&start, std::size_t &length)
+    {
+        const char  *end = std::strchr(text, '\n');
+
+        if (end == BETTER_ENUMS_NULLPTR)
+            return false;
+
+        start = text;
+        length = static_cast<std::size_t>(end - text);
+        text = end + 1;
+        return true;
+    }
+
+    bool token(const char *&start, std::size_t &length)
+    {
+        std::size_t     count = 0;
+
+        while (text[count] != '\0' && !_ends_name(text[count]))
+            ++count;
+
+        if (count == 0)
+            return false;
+
+        start = text;
+        length = count;
+        text += count;
+        return true;
+    }
+
+    bool separator(char c)
+    {
+        if (*text != c)
+            return false;
+
+        ++text;
+        return true;
+    }
+
+    // Also returns false if the number doesn't fit in Unsigned.
+    template <typename Unsigned>
+    bool number(Unsigned &result, unsigned int base = 10)
+    {
+        const char          *digits = "0123456789abcdef";
+        Unsigned            accumulated = 0;
+        std::size_t         count = 0;
+
+        for (; text[count] != '\0'; ++count) {
+            const char  *digit = std::strchr(digits, text[count]);
+
+            if (digit == BETTER_ENUMS_NULLPTR || *digit == '\0' ||
+                static_cast<unsigned int>(digit - digits) >= base) {
+
+                break;
+            }
+
+            Unsigned    next = static_cast<Unsigned>(digit - digits);
+
+            if (accumulated > (Unsigned(-1) - next) / base)
+                return false;
+
+            accumulated = static_cast<Unsigned>(accumulated * base + next);
+        }
+
+        if (count == 0)
+            return false;
+
+        result = accumulated;
+        text += count;
+        return true;
+    }
+
+    // The number of newlines in the rest of the input.
+    std::size_t lines() const
+    {
+        std::size_t     count = 0;
+
+        for (const char *c = text; *c != '\0'; ++c) {
+            if (*c == '\n')
+                ++count;
+        }
+
+        return count;
+    }
+
+    bool end() const { return *text == '\0'; }
+
+    bool value(descriptor::integral &result)
+    {
+        bool                negative = separator('-');
+        _fingerprint_wide   magnitude = 0;
+
+        if (!number(magnitude))
+            return false;
+
+        result =
+            static_cast<descriptor::integral>(
+                negative ? _fingerprint_wide(0) - magnitude : magnitude);
+        return true;
+    }
+
+    const char  *text;
+};
+
+inline std::size_t _schema_dense_limit(std::size_t count)
+{
+    return 2 * count + 64;
+}
+
+// Translates the values of a peer's version of Enum into local constants. Load
+// the peer's schema, as written by write_schema, or its descriptor, and then
+// call to_local with each peer value. Peer constants whose names are not
+// declared locally translate to an empty optional, as do values that the peer
+// didn't declare. The table is allocated when it is loaded, so schema_remap
+// can't be copied.
+template <typename Enum>
+class schema_remap {
+  public:
+    typedef descriptor::integral                                    integral;
+
+    schema_remap() :
+        _indices(BETTER_ENUMS_NULLPTR), _peer_values(BETTER_ENUMS_NULLPTR),
+        _count(0), _range(0), _smallest(0), _unmatched(0) { }
+
+    ~schema_remap() { _clear(); }
+
+    // Returns false, and leaves the remap empty, if the schema is malformed,
+    // if its type name is not Enum::_name(), or if its fingerprint doesn't
+    // match its constants. The underlying type of the peer may differ. The
+    // count of constants is checked against the number of remaining lines
+    // before anything is allocated.
+    bool load(const char *peer_schema)
+    {
+        _schema_input       input(peer_schema);
+        const char          *start = BETTER_ENUMS_NULLPTR;
+        std::size_t         length = 0;
+        std::size_t         count = 0;
+        unsigned int        fingerprint = 0;
+        unsigned int        hash = 2166136261u;
+
+        _clear();
+
+        if (!input.line(start, length) ||
+            length != std::strlen(Enum::_name()) ||
+            std::strncmp(start, Enum::_name(), length) != 0) {
+
+            return false;
+        }
+
+        if (!input.line(start, length) ||
+            !input.number(count) || !input.separator(' ') ||
+            !input.number(fingerprint, 16) || !input.separator('\n') ||
+            count != input.lines()) {
+
+            return false;
+        }
+
+        _allocate(count);
+
+        for (std::size_t position = 0; position < _count; ++position) {
+            integral    value = 0;
+
+            if (!input.token(start, length) || !input.separator(' ') ||
+                !input.value(value) || !input.separator('\n')) {
+
+                _clear();
+                return false;
+            }
+
+            hash = _fingerprint_value(_fingerprint_token(hash, start, length),
+                                      value);
+            _add(position, start, length, value);
+        }
+
+        if (!input.end() || hash != fingerprint) {
+            _clear();
+            return false;
+        }
+
+        _build();
+        return true;
+    }
+
+    void load(const descriptor &peer)
+    {
+        _clear();
+        _allocate(peer.size);
+
+        for (std::size_t position = 0; position < _count; ++position) {
+            _add(position, peer.raw_names[position],
+                 _constant_length(peer.raw_names[position]),
+                 peer.values[position]);
+        }
+
+        _build();
+    }
+
+    optional<Enum> to_local(integral peer_value) const
+    {
+        std::size_t     index = _local_index(peer_value);
+
+        return
+            index < Enum::_size_constant ?
+                optional<Enum>(Enum::_values()[index]) : optional<Enum>();
+    }
+
+    // The number of peer constants with no local constant of the same name.
+    std::size_t unmatched() const { return _unmatched; }
+
+  private:
+    typedef typename _compact_index<Enum::_size_constant>::type     _index;
+
+    schema_remap(const schema_remap&);
+    schema_remap& operator =(const schema_remap&);
+
+    // Same as _fingerprint_name, but iterative, since peer names can be long.
+    static unsigned int _fingerprint_token(unsigned int hash, const char *name,
+                                           std::size_t length)
+    {
+        for (std::size_t index = 0; index < length; ++index) {
+            hash =
+                _fingerprint_byte(hash,
+                                  static_cast<unsigned char>(name[index]));
+        }
+
+        return _fingerprint_byte(hash, 0);
+    }
+
+    void _clear()
+    {
+        delete[] _indices;
+        delete[] _peer_values;
+        _indices = BETTER_ENUMS_NULLPTR;
+        _peer_values = BETTER_ENUMS_NULLPTR;
+        _count = 0;
+        _range = 0;
+        _smallest = 0;
+        _unmatched = 0;
+    }
+
+    void _allocate(std::size_t count)
+    {
+        _count = count;
+        _indices = new _index[count];
+        _peer_values = new integral[count];
+    }
+
+    void _add(std::size_t position, const char *name, std::size_t length,
+              integral value)
+    {
+        optional<Enum>  local = Enum::_from_string_nothrow(name, length);
+
+        _peer_values[position] = value;
+        _indices[position] =
+            static_cast<_index>(local ? local->_to_index() :
+                                        Enum::_size_constant);
+        if (!local)
+            ++_unmatched;
+    }
+
+    // Either replaces the pairs of peer values and indices with a table
+    // indexed by peer value, or sorts them by peer value. In both cases, the
+    // pair that comes first in the peer's declaration order wins.
+    void _build()
+    {
+        if (_count == 0)
+            return;
+
+        integral    largest = _peer_values[0];
+
+        _smallest = _peer_values[0];
+        for (std::size_t position = 1; position < _count; ++position) {
+            if (_peer_values[position] < _smallest)
+                _smallest = _peer_values[position];
+            if (_peer_values[position] > largest)
+                largest = _peer_values[position];
+        }
+
+        _fingerprint_wide   span =
+            static_cast<_fingerprint_wide>(largest) -
+            static_cast<_fingerprint_wide>(_smallest);
+
+        if (span < _schema_dense_limit(_count)) {
+            _range = span + 1;
+
+            _index      *table = new _index[_range];
+
+            for (_fingerprint_wide offset = 0; offset < _range; ++offset)
+                table[offset] = static_cast<_index>(Enum::_size_constant);
+
+            for (std::size_t position = _count; position > 0; --position) {
+                table[_distance(_peer_values[position - 1])] =
+                    _indices[position - 1];
+            }
+
+            delete[] _indices;
+            delete[] _peer_values;
+            _indices = table;
+            _peer_values = BETTER_ENUMS_NULLPTR;
+        }
+        else {
+            // Stable insertion sort, so that the first of equal values stays
+            // first.
+            for (std::size_t position = 1; position < _count; ++position) {
+                integral        value = _peer_values[position];
+                _index          index = _indices[position];
+                std::size_t     hole = position;
+
+                for (; hole > 0 && _peer_values[hole - 1] > value; --hole) {
+                    _peer_values[hole] = _peer_values[hole - 1];
+                    _indices[hole] = _indices[hole - 1];
+                }
+
+                _peer_values[hole] = value;
+                _indices[hole] = index;
+            }
+        }
+    }
+
+    _fingerprint_wide _distance(integral peer_value) const
+    {
+        return
+            static_cast<_fingerprint_wide>(peer_value) -
+            static_cast<_fingerprint_wide>(_smallest);
+    }
+
+    std::size_t _local_index(integral peer_value) const
+    {
+        if (_range > 0) {
+            _fingerprint_wide   distance = _distance(peer_value);
+
+            return
+                distance < _range ?
+                    _indices[distance] :
+                    Enum::_size_constant;
+        }
+
+        std::size_t     low = 0;
+        std::size_t     high = _count;
+
+        while (low < high) {
+            std::size_t middle = low + (high - low) / 2;
+
+            if (_peer_values[middle] < peer_value)
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        return
+            low < _count && _peer_values[low] == peer_value ?
+                _indices[low] : Enum::_size_constant;
+    }
+
+    _index              *_indices;
+    integral            *_peer_values;
+    std::size_t         _count;
+    _fingerprint_wide   _range;
+    integral            _smallest;
+    std::size_t         _unmatched;
+};
+
+}
+
+
+
+#endif // #ifndef BETTER_ENUMS_SCHEMA_H
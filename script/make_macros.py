@@ -32,6 +32,14 @@
 #    or use any other method of getting these macros defined.
 # 3. Compile your code. Your macro file should be included, and enum.h should
 #    happily work with whatever limits you chose.
+#
+# For enums with hundreds of constants, pass a third argument, the chunk size,
+# as in python make_macros.py 512 128 16 > MACRO_FILE. Each level of the
+# generated BETTER_ENUMS_PP_MAP then handles that many constants at once, which
+# makes preprocessing large enums several times faster. The macros that are
+# inlined into enum.h are generated with the default chunk size of 1.
+
+from __future__ import print_function
 
 import os
 import sys
@@ -53,7 +61,7 @@ class MultiLine(object):
                 break_line = True
 
         if break_line:
-            print >> self._stream, ' ' * (self._columns_left - 1) + '\\'
+            print(' ' * (self._columns_left - 1) + '\\', file=self._stream)
             self._stream.write(' ' * self._indent)
             self._columns_left = self._columns - self._indent
             token = token.lstrip()
@@ -61,43 +69,74 @@ class MultiLine(object):
         self._stream.write(token)
         self._columns_left -= len(token)
 
-def generate(stream, constants, length, script):
-    print >> stream, '// This file was automatically generated by ' + script
-
-    print >> stream, ''
-    print >> stream, '#pragma once'
-    print >> stream, ''
-    print >> stream, '#ifndef BETTER_ENUMS_MACRO_FILE_H'
-    print >> stream, '#define BETTER_ENUMS_MACRO_FILE_H'
-
-    print >> stream, ''
-    print >> stream, '#define BETTER_ENUMS_PP_MAP(macro, data, ...) \\'
-    print >> stream, '    BETTER_ENUMS_ID( \\'
-    print >> stream, '        BETTER_ENUMS_APPLY( \\'
-    print >> stream, '            BETTER_ENUMS_PP_MAP_VAR_COUNT, \\'
-    print >> stream, '            BETTER_ENUMS_PP_COUNT(__VA_ARGS__)) \\'
-    print >> stream, '        (macro, data, __VA_ARGS__))'
-
-    print >> stream, ''
-    print >> stream, '#define BETTER_ENUMS_PP_MAP_VAR_COUNT(count) ' + \
-                     'BETTER_ENUMS_M ## count'
-
-    print >> stream, ''
-    print >> stream, '#define BETTER_ENUMS_APPLY(macro, ...) ' + \
-                      'BETTER_ENUMS_ID(macro(__VA_ARGS__))'
-
-    print >> stream, ''
-    print >> stream, '#define BETTER_ENUMS_ID(x) x'
-
-    print >> stream, ''
-    print >> stream, '#define BETTER_ENUMS_M1(m, d, x) m(d,0,x)'
+def generate_linear_map(stream, constants):
+    print('#define BETTER_ENUMS_M1(m, d, x) m(d,0,x)', file=stream)
     for index in range(2, constants + 1):
-        print >> stream, '#define BETTER_ENUMS_M' + str(index) + \
-                         '(m,d,x,...) m(d,' + str(index - 1) + ',x) \\'
-        print >> stream, '    BETTER_ENUMS_ID(BETTER_ENUMS_M' + \
-                         str(index - 1) + '(m,d,__VA_ARGS__))'
-
-    print >> stream, ''
+        print('#define BETTER_ENUMS_M' + str(index) +
+              '(m,d,x,...) m(d,' + str(index - 1) + ',x) \\', file=stream)
+        print('    BETTER_ENUMS_ID(BETTER_ENUMS_M' +
+              str(index - 1) + '(m,d,__VA_ARGS__))', file=stream)
+
+# Each BETTER_ENUMS_Mn with n > chunk takes chunk constants as named parameters,
+# and passes the rest on to BETTER_ENUMS_M(n - chunk). The preprocessor rescans
+# the remaining constants once per level, so the work done for an enum with n
+# constants falls from roughly n * n / 2 to n * n / (2 * chunk).
+def generate_chunked_map(stream, constants, chunk):
+    for index in range(1, constants + 1):
+        named = min(index, chunk)
+        parameters = ['x' + str(parameter) for parameter in range(named)]
+        if index > chunk:
+            parameters.append('...')
+
+        prefix = '#define BETTER_ENUMS_M' + str(index) + \
+                 '(m,d,' + ','.join(parameters) + ')'
+        stream.write(prefix)
+        body = MultiLine(stream = stream, indent = 4,
+                         initial_column = len(prefix))
+        for parameter in range(named):
+            body.write(' m(d,' + str(index - 1 - parameter) + ',x' +
+                       str(parameter) + ')', last = parameter == named - 1 and
+                                                  index <= chunk)
+        if index > chunk:
+            body.write(' BETTER_ENUMS_ID(BETTER_ENUMS_M' +
+                       str(index - chunk) + '(m,d,__VA_ARGS__))', last = True)
+        print('', file=stream)
+
+def generate(stream, constants, length, chunk, script):
+    print('// This file was automatically generated by ' + script, file=stream)
+
+    print('', file=stream)
+    print('#pragma once', file=stream)
+    print('', file=stream)
+    print('#ifndef BETTER_ENUMS_MACRO_FILE_H', file=stream)
+    print('#define BETTER_ENUMS_MACRO_FILE_H', file=stream)
+
+    print('', file=stream)
+    print('#define BETTER_ENUMS_PP_MAP(macro, data, ...) \\', file=stream)
+    print('    BETTER_ENUMS_ID( \\', file=stream)
+    print('        BETTER_ENUMS_APPLY( \\', file=stream)
+    print('            BETTER_ENUMS_PP_MAP_VAR_COUNT, \\', file=stream)
+    print('            BETTER_ENUMS_PP_COUNT(__VA_ARGS__)) \\', file=stream)
+    print('        (macro, data, __VA_ARGS__))', file=stream)
+
+    print('', file=stream)
+    print('#define BETTER_ENUMS_PP_MAP_VAR_COUNT(count) ' +
+          'BETTER_ENUMS_M ## count', file=stream)
+
+    print('', file=stream)
+    print('#define BETTER_ENUMS_APPLY(macro, ...) ' +
+          'BETTER_ENUMS_ID(macro(__VA_ARGS__))', file=stream)
+
+    print('', file=stream)
+    print('#define BETTER_ENUMS_ID(x) x', file=stream)
+
+    print('', file=stream)
+    if chunk > 1:
+        generate_chunked_map(stream, constants, chunk)
+    else:
+        generate_linear_map(stream, constants)
+
+    print('', file=stream)
     pp_count_impl_prefix = '#define BETTER_ENUMS_PP_COUNT_IMPL(_1,'
     stream.write(pp_count_impl_prefix)
     pp_count_impl = MultiLine(stream = stream, indent = 4,
@@ -107,10 +146,10 @@ def generate(stream, constants, length, script):
     pp_count_impl.write(' count,')
     pp_count_impl.write(' ...)')
     pp_count_impl.write(' count', last = True)
-    print >> stream, ''
+    print('', file=stream)
 
-    print >> stream, ''
-    print >> stream, '#define BETTER_ENUMS_PP_COUNT(...) \\'
+    print('', file=stream)
+    print('#define BETTER_ENUMS_PP_COUNT(...) \\', file=stream)
     pp_count_prefix = \
         '    BETTER_ENUMS_ID(BETTER_ENUMS_PP_COUNT_IMPL(__VA_ARGS__,'
     stream.write(pp_count_prefix)
@@ -119,31 +158,41 @@ def generate(stream, constants, length, script):
     for index in range(0, constants - 1):
         pp_count.write(' ' + str(constants - index) + ',')
     pp_count.write(' 1))', last = True)
-    print >> stream, ''
+    print('', file=stream)
 
-    print >> stream, ''
+    print('', file=stream)
     iterate_prefix = '#define BETTER_ENUMS_ITERATE(X, f, l)'
     stream.write(iterate_prefix)
     iterate = MultiLine(stream = stream, indent = 4,
                         initial_column = len(iterate_prefix))
     for index in range(0, length):
         iterate.write(' X(f, l, %i)' % index)
-    print >> stream, ''
+    print('', file=stream)
 
-    print >> stream, ''
-    print >> stream, '#endif // #ifndef BETTER_ENUMS_MACRO_FILE_H'
+    print('', file=stream)
+    print('#endif // #ifndef BETTER_ENUMS_MACRO_FILE_H', file=stream)
 
 if __name__ == '__main__':
-    if len(sys.argv) != 3:
-        print >> sys.stderr, \
-            'Usage: ' + sys.argv[0] + ' CONSTANTS LENGTH > FILE'
-        print >> sys.stderr, ''
-        print >> sys.stderr, 'Prints map macro definition to FILE.'
-        print >> sys.stderr, 'CONSTANTS is the number of constants to support.'
-        print >> sys.stderr, 'LENGTH is the maximum length of a constant name.'
+    if len(sys.argv) not in [3, 4]:
+        print('Usage: ' + sys.argv[0] + ' CONSTANTS LENGTH [CHUNK] > FILE',
+              file=sys.stderr)
+        print('', file=sys.stderr)
+        print('Prints map macro definition to FILE.', file=sys.stderr)
+        print('CONSTANTS is the number of constants to support.',
+              file=sys.stderr)
+        print('LENGTH is the maximum length of a constant name.',
+              file=sys.stderr)
+        print('CHUNK is the number of constants handled by each level of the',
+              file=sys.stderr)
+        print('map macro. The default is 1. Use 16 or so for large enums.',
+              file=sys.stderr)
         sys.exit(1)
 
-    generate(sys.stdout, int(sys.argv[1]), int(sys.argv[2]),
+    chunk = 1
+    if len(sys.argv) == 4:
+        chunk = int(sys.argv[3])
+
+    generate(sys.stdout, int(sys.argv[1]), int(sys.argv[2]), chunk,
              os.path.basename(sys.argv[0]))
 
     sys.exit(0)
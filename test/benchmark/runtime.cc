@@ -0,0 +1,295 @@
+// Run-time micro-benchmark of the conversion functions of Better Enums.
+//
+// Usage: benchmark-runtime [ITERATIONS]
+//
+// Calls each conversion function ITERATIONS times (by default, 1000000) on each
+// of four enums: small and dense, medium and sparse, and large with dense and
+// sparse values. Prints the average time per call in nanoseconds, as CSV.
+//
+// Each measured function is wrapped in a function that is not inlined, so the
+// code generated for it can be inspected. runtime.py in this directory runs the
+// benchmark and adds the size of each wrapper to its row.
+//
+// Build with optimizations for meaningful timings. The CMake build in test/
+// does this for the benchmark-runtime target, and "make runtime" writes the
+// timings and sizes to runtime.csv.
+
+#include <cctype>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <enum.h>
+
+
+
+#if defined(__GNUC__)
+#   define BENCHMARK_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#   define BENCHMARK_NOINLINE __declspec(noinline)
+#else
+#   define BENCHMARK_NOINLINE
+#endif
+
+
+
+BETTER_ENUM(SmallDense, int, Red, Green, Blue, Cyan, Magenta)
+
+BETTER_ENUM(MediumSparse, int,
+            Continue = 100, SwitchingProtocols = 101, OK = 200, Created = 201,
+            Accepted = 202, NoContent = 204, MovedPermanently = 301,
+            Found = 302, NotModified = 304, BadRequest = 400,
+            Unauthorized = 401, Forbidden = 403, NotFound = 404,
+            MethodNotAllowed = 405, Conflict = 409, Gone = 410,
+            InternalServerError = 500, NotImplemented = 501,
+            BadGateway = 502, ServiceUnavailable = 503)
+
+BETTER_ENUM(LargeDense, int,
+            Key0, Key1, Key2, Key3, Key4, Key5, Key6, Key7, Key8, Key9, Key10,
+            Key11, Key12, Key13, Key14, Key15, Key16, Key17, Key18, Key19,
+            Key20, Key21, Key22, Key23, Key24, Key25, Key26, Key27, Key28,
+            Key29, Key30, Key31, Key32, Key33, Key34, Key35, Key36, Key37,
+            Key38, Key39, Key40, Key41, Key42, Key43, Key44, Key45, Key46,
+            Key47, Key48, Key49, Key50, Key51, Key52, Key53, Key54, Key55,
+            Key56, Key57, Key58, Key59, Key60, Key61, Key62, Key63)
+
+BETTER_ENUM(LargeSparse, int,
+            Tag0 = 3, Tag1 = 101, Tag2 = 201, Tag3 = 303, Tag4 = 407,
+            Tag5 = 513, Tag6 = 621, Tag7 = 690, Tag8 = 802, Tag9 = 916,
+            Tag10 = 991, Tag11 = 1109, Tag12 = 1188, Tag13 = 1269,
+            Tag14 = 1393, Tag15 = 1478, Tag16 = 1565, Tag17 = 1654,
+            Tag18 = 1786, Tag19 = 1879, Tag20 = 1974, Tag21 = 2071,
+            Tag22 = 2170, Tag23 = 2271, Tag24 = 2333, Tag25 = 2438,
+            Tag26 = 2545, Tag27 = 2654, Tag28 = 2724, Tag29 = 2837,
+            Tag30 = 2952, Tag31 = 3028, Tag32 = 3147, Tag33 = 3227,
+            Tag34 = 3309, Tag35 = 3434, Tag36 = 3520, Tag37 = 3608,
+            Tag38 = 3698, Tag39 = 3790, Tag40 = 3884, Tag41 = 3980,
+            Tag42 = 4078, Tag43 = 4178, Tag44 = 4280, Tag45 = 4384,
+            Tag46 = 4490, Tag47 = 4598, Tag48 = 4667, Tag49 = 4779,
+            Tag50 = 4893, Tag51 = 4968, Tag52 = 5086, Tag53 = 5165,
+            Tag54 = 5246, Tag55 = 5370, Tag56 = 5455, Tag57 = 5542,
+            Tag58 = 5631, Tag59 = 5763, Tag60 = 5856, Tag61 = 5951,
+            Tag62 = 6048, Tag63 = 6147)
+
+
+
+template <typename Enum>
+int code(Enum value)
+{
+    return value._to_integral() * 3 + 1;
+}
+
+template <typename Enum>
+struct operations {
+    typedef typename Enum::_integral    integral;
+
+    static BENCHMARK_NOINLINE const char* to_string(Enum value)
+    {
+        return value._to_string();
+    }
+
+    static BENCHMARK_NOINLINE Enum from_string(const char *name)
+    {
+        return Enum::_from_string(name);
+    }
+
+    static BENCHMARK_NOINLINE Enum from_string_nocase(const char *name)
+    {
+        return Enum::_from_string_nocase(name);
+    }
+
+    static BENCHMARK_NOINLINE bool from_integral_nothrow(integral value)
+    {
+        return Enum::_from_integral_nothrow(value);
+    }
+
+    static BENCHMARK_NOINLINE bool is_valid(integral value)
+    {
+        return Enum::_is_valid(value);
+    }
+
+    static BENCHMARK_NOINLINE std::size_t to_index(Enum value)
+    {
+        return value._to_index();
+    }
+
+    static BENCHMARK_NOINLINE std::size_t write(Enum value)
+    {
+        static std::ostringstream   stream;
+
+        stream.str(std::string());
+        stream << value;
+
+        return static_cast<std::size_t>(stream.tellp());
+    }
+
+    static BENCHMARK_NOINLINE Enum read(const char *name)
+    {
+        static std::istringstream   stream;
+        Enum                        value = Enum::_values()[0];
+
+        stream.clear();
+        stream.str(name);
+        stream >> value;
+
+        return value;
+    }
+
+    static BENCHMARK_NOINLINE Enum map_to_enum(int value)
+    {
+        static const better_enums::map<Enum, int>   map =
+            better_enums::make_map(code<Enum>);
+
+        return map.to_enum(value);
+    }
+
+    static BENCHMARK_NOINLINE Enum table_map_to_enum(int value)
+    {
+        static const better_enums::table_map<Enum, int> map =
+            better_enums::make_table_map(code<Enum>);
+
+        return map.to_enum(value);
+    }
+};
+
+
+
+// Each result is folded into this variable, so that the calls are not optimized
+// away.
+static volatile std::size_t     sink;
+
+static void consume(std::size_t result) { sink = sink + result; }
+static void consume(bool result) { consume(static_cast<std::size_t>(result)); }
+
+static void consume(const char *result)
+{
+    consume(static_cast<std::size_t>(*result));
+}
+
+template <typename Enum>
+static void consume(Enum result)
+{
+    consume(static_cast<std::size_t>(result._to_integral()));
+}
+
+struct benchmark_case {
+    const char          *enum_name;
+    std::size_t         size;
+    const char          *layout;
+    std::size_t         iterations;
+};
+
+template <typename Input, typename Result>
+static void measure(const benchmark_case &context, const char *operation,
+                    Result (*function)(Input), const std::vector<Input> &inputs)
+{
+    // Warm up, so that function-local statics are initialized and the inputs
+    // are in cache.
+    for (std::size_t i = 0; i < inputs.size(); ++i)
+        consume(function(inputs[i]));
+
+    std::clock_t    start = std::clock();
+
+    for (std::size_t i = 0; i < context.iterations; ++i)
+        consume(function(inputs[i % inputs.size()]));
+
+    double          nanoseconds =
+        static_cast<double>(std::clock() - start) * 1e9 / CLOCKS_PER_SEC /
+        static_cast<double>(context.iterations);
+
+    std::printf("%s,%u,%s,%s,%.2f\n", context.enum_name,
+                static_cast<unsigned>(context.size), context.layout, operation,
+                nanoseconds);
+}
+
+template <typename Enum>
+static void benchmark(const char *enum_name, const char *layout,
+                      std::size_t iterations)
+{
+    typedef operations<Enum>                ops;
+    typedef typename Enum::_integral        integral;
+
+    const std::size_t           size = Enum::_size();
+    const benchmark_case        context =
+        { enum_name, size, layout, iterations };
+
+    // Names are copied, so that lookups cannot succeed by comparing pointers.
+    // The integral inputs alternate between valid and invalid values.
+    std::vector<Enum>           values;
+    std::vector<std::string>    names;
+    std::vector<std::string>    lowercase_names;
+    std::vector<integral>       integrals;
+    std::vector<int>            codes;
+
+    integral                    largest = Enum::_values()[0]._to_integral();
+
+    for (std::size_t index = 0; index < size; ++index) {
+        Enum            value = Enum::_values()[index];
+        std::string     lowercase = value._to_string();
+
+        for (std::size_t c = 0; c < lowercase.size(); ++c) {
+            lowercase[c] = static_cast<char>(
+                std::tolower(static_cast<unsigned char>(lowercase[c])));
+        }
+
+        values.push_back(value);
+        names.push_back(value._to_string());
+        lowercase_names.push_back(lowercase);
+        codes.push_back(code(value));
+
+        if (value._to_integral() > largest)
+            largest = value._to_integral();
+    }
+
+    for (std::size_t index = 0; index < size; ++index) {
+        integrals.push_back(values[index]._to_integral());
+        integrals.push_back(static_cast<integral>(largest + 1 + index));
+    }
+
+    std::vector<const char*>    name_pointers;
+    std::vector<const char*>    lowercase_pointers;
+
+    for (std::size_t index = 0; index < size; ++index) {
+        name_pointers.push_back(names[index].c_str());
+        lowercase_pointers.push_back(lowercase_names[index].c_str());
+    }
+
+    measure(context, "_to_string", ops::to_string, values);
+    measure(context, "_from_string", ops::from_string, name_pointers);
+    measure(context, "_from_string_nocase", ops::from_string_nocase,
+            lowercase_pointers);
+    measure(context, "_from_integral_nothrow", ops::from_integral_nothrow,
+            integrals);
+    measure(context, "_is_valid", ops::is_valid, integrals);
+    measure(context, "_to_index", ops::to_index, values);
+    measure(context, "operator<<", ops::write, values);
+    measure(context, "operator>>", ops::read, name_pointers);
+    measure(context, "map::to_enum", ops::map_to_enum, codes);
+    measure(context, "table_map::to_enum", ops::table_map_to_enum, codes);
+}
+
+int main(int argc, char *argv[])
+{
+    std::size_t     iterations = 1000000;
+
+    if (argc > 1)
+        iterations = static_cast<std::size_t>(std::strtoul(argv[1], NULL, 10));
+
+    if (iterations == 0) {
+        std::cerr << "usage: " << argv[0] << " [ITERATIONS]" << std::endl;
+        return 1;
+    }
+
+    std::printf("enum,constants,values,operation,ns_per_op\n");
+
+    benchmark<SmallDense>("SmallDense", "dense", iterations);
+    benchmark<MediumSparse>("MediumSparse", "sparse", iterations);
+    benchmark<LargeDense>("LargeDense", "dense", iterations);
+    benchmark<LargeSparse>("LargeSparse", "sparse", iterations);
+
+    return 0;
+}
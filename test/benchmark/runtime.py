@@ -0,0 +1,105 @@
+#! /usr/bin/env python
+
+# Run-time benchmark for Better Enums, with code sizes.
+#
+# Runs benchmark-runtime, which prints the average time of each conversion as
+# CSV, and adds the size in bytes of the code generated for each conversion to
+# each row. The size is that of the wrapper in struct operations in runtime.cc
+# that calls the conversion, as listed by nm, and so includes the code that was
+# inlined into the wrapper, but not functions that it calls.
+#
+# Usage:
+#
+#     python runtime.py BINARY [--iterations N] [--nm NM] [--output FILE]
+#
+# For example, in the CMake build directory,
+#
+#     python ../benchmark/runtime.py ./benchmark-runtime > runtime.csv
+#
+# Only nm with a GNU-compatible command line is supported, such as GNU nm and
+# llvm-nm. If a wrapper is not found, for example because the linker folded it
+# into another one, its size is left empty.
+
+from __future__ import print_function
+
+import argparse
+import re
+import subprocess
+import sys
+
+
+
+# The wrappers in struct operations, and the names under which runtime.cc
+# reports the conversions they call.
+OPERATIONS = {
+    'to_string': '_to_string',
+    'from_string': '_from_string',
+    'from_string_nocase': '_from_string_nocase',
+    'from_integral_nothrow': '_from_integral_nothrow',
+    'is_valid': '_is_valid',
+    'to_index': '_to_index',
+    'write': 'operator<<',
+    'read': 'operator>>',
+    'map_to_enum': 'map::to_enum',
+    'table_map_to_enum': 'table_map::to_enum',
+}
+
+# A line of nm -C -S output for a function, such as
+#
+#     0000000000007400 000000000000000e W operations<LargeDense>::to_index(...)
+#
+# Lines for guard variables and function-local statics don't match.
+SYMBOL = re.compile(r'^[0-9a-fA-F]+ ([0-9a-fA-F]+) [tTwW] '
+                    r'operations<(\w+)>::(\w+)\(')
+
+
+
+def code_sizes(binary, nm):
+    output = subprocess.check_output([nm, '-C', '-S', binary])
+
+    sizes = {}
+    for line in output.decode('utf-8', 'replace').splitlines():
+        match = SYMBOL.match(line)
+        if match is None or match.group(3) not in OPERATIONS:
+            continue
+        key = (match.group(2), OPERATIONS[match.group(3)])
+        sizes[key] = int(match.group(1), 16)
+    return sizes
+
+def run(arguments):
+    command = [arguments.binary]
+    if arguments.iterations is not None:
+        command.append(str(arguments.iterations))
+
+    timings = subprocess.check_output(command).decode('utf-8', 'replace')
+    sizes = code_sizes(arguments.binary, arguments.nm)
+
+    lines = timings.splitlines()
+    rows = [lines[0] + ',bytes']
+    for line in lines[1:]:
+        fields = line.split(',')
+        size = sizes.get((fields[0], fields[3]))
+        rows.append(line + ',' + ('' if size is None else str(size)))
+    return rows
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        description = 'Measures run time and code size of Better Enums.')
+    parser.add_argument('binary')
+    parser.add_argument('--iterations', type = int, default = None)
+    parser.add_argument('--nm', default = 'nm')
+    parser.add_argument('--output', default = None)
+    arguments = parser.parse_args()
+
+    rows = run(arguments)
+
+    if arguments.output is None:
+        stream = sys.stdout
+    else:
+        stream = open(arguments.output, 'w')
+
+    for row in rows:
+        print(row, file=stream)
+
+    if arguments.output is not None:
+        stream.close()
@@ -0,0 +1,245 @@
+#include <cxxtest/TestSuite.h>
+#include <string>
+#include <enum.h>
+
+
+
+namespace containers {
+
+BETTER_ENUM(Fruit, short, Orange = 3, Apple = 1, Pear = 7, Plum, Quince = 100,
+            Pomme = Apple)
+
+BETTER_ENUM(Permission, int,
+            Read, Write, Execute, Delete, Share, Admin, P6, P7, P8, P9, P10,
+            P11, P12, P13, P14, P15, P16, P17, P18, P19, P20, P21, P22, P23,
+            P24, P25, P26, P27, P28, P29, P30, P31, P32, P33, P34, P35, P36,
+            P37, P38, P39, P40, P41, P42, P43, P44, P45, P46, P47, P48, P49,
+            P50, P51, P52, P53, P54, P55, P56, P57, P58, P59, P60, P61, P62,
+            Last = 1000)
+
+}
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+constexpr better_enums::enum_array<containers::Fruit, int>   calories =
+    {{ 47, 52, 57, 46, 57, 52 }};
+
+static_assert(calories[containers::Fruit::Pear] == 57, "constexpr enum_array");
+static_assert(calories.size() == containers::Fruit::_size(),
+              "constexpr enum_array");
+
+#ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
+
+constexpr better_enums::enum_set<containers::Fruit> make_fruit_set()
+{
+    better_enums::enum_set<containers::Fruit>   result;
+
+    result.insert(containers::Fruit::Plum);
+    result.insert(containers::Fruit::Orange);
+
+    return result;
+}
+
+static_assert(make_fruit_set().contains(containers::Fruit::Plum),
+              "constexpr enum_set");
+static_assert(!make_fruit_set().contains(containers::Fruit::Apple),
+              "constexpr enum_set");
+static_assert(make_fruit_set().size() == 2, "constexpr enum_set");
+
+#endif
+
+#endif
+
+
+
+class EnumArrayTests : public CxxTest::TestSuite {
+  public:
+    void test_indexing()
+    {
+        better_enums::enum_array<containers::Fruit, int>    counts =
+            {{ 0, 0, 0, 0, 0, 0 }};
+
+        ++counts[containers::Fruit::Quince];
+        ++counts[containers::Fruit::Apple];
+        ++counts[containers::Fruit::Pomme];
+
+        TS_ASSERT_EQUALS(counts[containers::Fruit::Quince], 1);
+        TS_ASSERT_EQUALS(counts[containers::Fruit::Apple], 2);
+        TS_ASSERT_EQUALS(counts[containers::Fruit::Orange], 0);
+        TS_ASSERT_EQUALS(counts.data()[4], 1);
+    }
+
+    void test_iteration_order()
+    {
+        better_enums::enum_array<containers::Fruit, std::string>    names;
+
+        for (size_t index = 0; index < names.size(); ++index)
+            names[names.key(index)] = names.key(index)._to_string();
+
+        better_enums::enum_array<containers::Fruit, std::string>::iterator
+                        element = names.begin();
+
+        TS_ASSERT_EQUALS(*element++, "Orange");
+        TS_ASSERT_EQUALS(*element++, "Apple");
+        TS_ASSERT_EQUALS(*element++, "Pear");
+        TS_ASSERT_EQUALS(*element++, "Plum");
+        TS_ASSERT_EQUALS(*element++, "Quince");
+        TS_ASSERT_EQUALS(*element++, "");
+        TS_ASSERT(element == names.end());
+    }
+
+    void test_fill()
+    {
+        better_enums::enum_array<containers::Fruit, char>   marks;
+
+        marks.fill('x');
+
+        for (const char *mark = marks.begin(); mark != marks.end(); ++mark)
+            TS_ASSERT_EQUALS(*mark, 'x');
+    }
+};
+
+class EnumMapTests : public CxxTest::TestSuite {
+  public:
+    void test_insert_find()
+    {
+        better_enums::enum_map<containers::Fruit, std::string>  colors;
+
+        TS_ASSERT(colors.empty());
+        TS_ASSERT(colors.insert(containers::Fruit::Pear, "green"));
+        TS_ASSERT(!colors.insert(containers::Fruit::Pear, "yellow"));
+        colors[containers::Fruit::Plum] = "purple";
+
+        TS_ASSERT_EQUALS(colors.size(), 2u);
+        TS_ASSERT_EQUALS(colors.count(containers::Fruit::Pear), 1u);
+        TS_ASSERT_EQUALS(colors.count(containers::Fruit::Apple), 0u);
+        TS_ASSERT_EQUALS(*colors.find(containers::Fruit::Pear), "green");
+        TS_ASSERT(colors.find(containers::Fruit::Quince) == NULL);
+        TS_ASSERT_EQUALS(colors.max_size(), 6u);
+    }
+
+    void test_erase()
+    {
+        better_enums::enum_map<containers::Fruit, int>  stock;
+
+        stock[containers::Fruit::Apple] = 4;
+        stock[containers::Fruit::Orange] = 2;
+
+        TS_ASSERT_EQUALS(stock.erase(containers::Fruit::Apple), 1u);
+        TS_ASSERT_EQUALS(stock.erase(containers::Fruit::Apple), 0u);
+        TS_ASSERT_EQUALS(stock.size(), 1u);
+        TS_ASSERT_EQUALS(stock[containers::Fruit::Apple], 0);
+        TS_ASSERT_EQUALS(stock.size(), 2u);
+
+        stock.clear();
+        TS_ASSERT(stock.empty());
+        TS_ASSERT(stock.begin() == stock.end());
+    }
+
+    void test_iteration()
+    {
+        better_enums::enum_map<containers::Fruit, int>  stock;
+
+        stock[containers::Fruit::Quince] = 1;
+        stock[containers::Fruit::Orange] = 3;
+        stock[containers::Fruit::Pear] = 7;
+
+        const better_enums::enum_map<containers::Fruit, int>    &view = stock;
+        better_enums::enum_map<containers::Fruit, int>::const_iterator
+                        entry = view.begin();
+
+        TS_ASSERT_EQUALS(entry.key(), +containers::Fruit::Orange);
+        TS_ASSERT_EQUALS(*entry, 3);
+        ++entry;
+        TS_ASSERT_EQUALS(entry.key(), +containers::Fruit::Pear);
+        ++entry;
+        TS_ASSERT_EQUALS(entry.key(), +containers::Fruit::Quince);
+        TS_ASSERT_EQUALS(entry.value(), 1);
+        ++entry;
+        TS_ASSERT(entry == view.end());
+
+        for (better_enums::enum_map<containers::Fruit, int>::iterator
+                 element = stock.begin(); element != stock.end(); ++element) {
+
+            *element *= 10;
+        }
+
+        TS_ASSERT_EQUALS(stock[containers::Fruit::Pear], 70);
+    }
+};
+
+class EnumSetTests : public CxxTest::TestSuite {
+  public:
+    void test_insert_erase()
+    {
+        better_enums::enum_set<containers::Fruit>   fruit;
+
+        TS_ASSERT(fruit.empty());
+        TS_ASSERT(fruit.insert(containers::Fruit::Pear));
+        TS_ASSERT(!fruit.insert(containers::Fruit::Pear));
+        TS_ASSERT(fruit.insert(containers::Fruit::Apple));
+        TS_ASSERT(fruit.contains(containers::Fruit::Pomme));
+        TS_ASSERT(!fruit.contains(containers::Fruit::Quince));
+        TS_ASSERT_EQUALS(fruit.size(), 2u);
+
+        TS_ASSERT_EQUALS(fruit.erase(containers::Fruit::Pear), 1u);
+        TS_ASSERT_EQUALS(fruit.erase(containers::Fruit::Pear), 0u);
+        TS_ASSERT_EQUALS(fruit.size(), 1u);
+
+        fruit.clear();
+        TS_ASSERT(fruit.empty());
+        TS_ASSERT(fruit.begin() == fruit.end());
+    }
+
+    void test_full_word()
+    {
+        better_enums::enum_set<containers::Permission>  permissions;
+
+        TS_ASSERT_EQUALS(permissions.max_size(), 64u);
+
+        permissions.insert(containers::Permission::Last);
+        permissions.insert(containers::Permission::Write);
+        permissions.insert(containers::Permission::P62);
+        permissions.insert(containers::Permission::P31);
+        TS_ASSERT_EQUALS(permissions.size(), 4u);
+
+        better_enums::enum_set<containers::Permission>::iterator
+                        member = permissions.begin();
+
+        TS_ASSERT_EQUALS(*member++, +containers::Permission::Write);
+        TS_ASSERT_EQUALS(*member++, +containers::Permission::P31);
+        TS_ASSERT_EQUALS(*member++, +containers::Permission::P62);
+        TS_ASSERT_EQUALS(*member++, +containers::Permission::Last);
+        TS_ASSERT(member == permissions.end());
+    }
+
+    void test_set_operations()
+    {
+        better_enums::enum_set<containers::Permission>  user;
+        better_enums::enum_set<containers::Permission>  required;
+
+        user.insert(containers::Permission::Read);
+        user.insert(containers::Permission::Write);
+        user.insert(containers::Permission::P62);
+        required.insert(containers::Permission::Write);
+        required.insert(containers::Permission::Admin);
+
+        better_enums::enum_set<containers::Permission>  both = user & required;
+        better_enums::enum_set<containers::Permission>  either = user | required;
+        better_enums::enum_set<containers::Permission>  missing =
+            required - user;
+
+        TS_ASSERT_EQUALS(both.size(), 1u);
+        TS_ASSERT(both.contains(containers::Permission::Write));
+        TS_ASSERT_EQUALS(either.size(), 4u);
+        TS_ASSERT(either.contains(containers::Permission::P62));
+        TS_ASSERT_EQUALS(missing.size(), 1u);
+        TS_ASSERT_EQUALS(*missing.begin(), +containers::Permission::Admin);
+
+        user |= required;
+        TS_ASSERT(user == either);
+        user &= both;
+        TS_ASSERT(user == both);
+        TS_ASSERT(user != either);
+    }
+};
@@ -0,0 +1,141 @@
+#include <cxxtest/TestSuite.h>
+#include <cstring>
+#include <enum.h>
+#include <better-enums/schema.h>
+
+
+
+namespace descriptors {
+
+BETTER_ENUM(Planet, int, Mercury = 1, Venus, Earth, Mars = 7, Terra = Earth)
+BETTER_ENUM(Flag, unsigned char, Off, On = 255)
+
+}
+
+namespace other_descriptors {
+
+BETTER_ENUM(Planet, short, Vulcan, Romulus)
+BETTER_ENUM(Flag, short, Down, Up)
+
+}
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+constexpr better_enums::descriptor  planet_descriptor =
+    better_enums::describe<descriptors::Planet>();
+
+static_assert(planet_descriptor.size == 5, "constexpr descriptor");
+static_assert(planet_descriptor.value(3) == 7, "constexpr descriptor");
+static_assert(*planet_descriptor.index_of_value(3) == 2,
+              "constexpr descriptor");
+static_assert(*planet_descriptor.index_of_name("Mars") == 3,
+              "constexpr descriptor");
+static_assert(!planet_descriptor.index_of_name("Pluto"),
+              "constexpr descriptor");
+static_assert(planet_descriptor.type_name[0] == 'P', "constexpr descriptor");
+
+#endif
+
+#ifdef BETTER_ENUMS_REGISTRY
+
+static const better_enums::descriptor   &registered_flag =
+    better_enums::register_enum<descriptors::Flag>();
+
+#endif
+
+
+
+class DescriptorTests : public CxxTest::TestSuite {
+  public:
+    void test_contents()
+    {
+        better_enums::descriptor    planet =
+            better_enums::describe<descriptors::Planet>();
+
+        TS_ASSERT_EQUALS(strcmp(planet.type_name, "Planet"), 0);
+        TS_ASSERT_EQUALS(planet.size, descriptors::Planet::_size());
+
+        for (size_t index = 0; index < planet.size; ++index) {
+            descriptors::Planet value = descriptors::Planet::_values()[index];
+
+            TS_ASSERT_EQUALS(planet.value(index), value._to_integral());
+            TS_ASSERT_EQUALS(strcmp(planet.name(index),
+                                    descriptors::Planet::_names()[index]), 0);
+        }
+
+        TS_ASSERT_EQUALS(strcmp(planet.name(4), "Terra"), 0);
+    }
+
+    void test_lookup()
+    {
+        better_enums::descriptor    planet =
+            better_enums::describe<descriptors::Planet>();
+
+        TS_ASSERT_EQUALS(*planet.index_of_value(2), 1u);
+        TS_ASSERT_EQUALS(*planet.index_of_value(3), 2u);
+        TS_ASSERT(!planet.index_of_value(4));
+
+        TS_ASSERT_EQUALS(*planet.index_of_name("Terra"), 4u);
+        TS_ASSERT(!planet.index_of_name("terra"));
+        TS_ASSERT_EQUALS(*planet.index_of_name_nocase("terra"), 4u);
+        TS_ASSERT(!planet.index_of_name_nocase("Pluto"));
+
+        TS_ASSERT_EQUALS(strcmp(planet.to_string(3), "Earth"), 0);
+        TS_ASSERT(planet.to_string(0) == NULL);
+    }
+
+    void test_unsigned_values()
+    {
+        better_enums::descriptor    flag =
+            better_enums::describe<descriptors::Flag>();
+
+        TS_ASSERT_EQUALS(flag.value(1), 255);
+        TS_ASSERT_EQUALS(strcmp(flag.to_string(255), "On"), 0);
+    }
+
+    void test_registry()
+    {
+#ifdef BETTER_ENUMS_REGISTRY
+        TS_ASSERT(better_enums::find_descriptor("Planet") == NULL);
+
+        const better_enums::descriptor  &planet =
+            better_enums::register_enum<descriptors::Planet>();
+
+        TS_ASSERT(&better_enums::register_enum<descriptors::Planet>() ==
+                  &planet);
+        TS_ASSERT(better_enums::find_descriptor("Planet") == &planet);
+        TS_ASSERT(better_enums::find_descriptor("Flag") == &registered_flag);
+        TS_ASSERT(better_enums::find_descriptor("Moon") == NULL);
+
+        const better_enums::descriptor  *found =
+            better_enums::find_descriptor("Flag");
+
+        TS_ASSERT_EQUALS(strcmp(found->name(*found->index_of_value(0)), "Off"),
+                         0);
+#endif
+    }
+
+    void test_registry_names()
+    {
+#ifdef BETTER_ENUMS_REGISTRY
+        const better_enums::descriptor  &qualified =
+            better_enums::register_enum<other_descriptors::Planet>(
+                "other_descriptors::Planet");
+
+        TS_ASSERT(better_enums::find_descriptor("other_descriptors::Planet") ==
+                  &qualified);
+        TS_ASSERT_EQUALS(
+            better_enums::count_descriptors("other_descriptors::Planet"), 1u);
+        TS_ASSERT_EQUALS(strcmp(qualified.type_name, "Planet"), 0);
+        TS_ASSERT_EQUALS(better_enums::count_descriptors("Planet"), 1u);
+        TS_ASSERT(better_enums::find_descriptor("Planet") !=
+                  better_enums::find_descriptor("other_descriptors::Planet"));
+
+        better_enums::register_enum<other_descriptors::Flag>();
+
+        TS_ASSERT_EQUALS(better_enums::count_descriptors("Flag"), 2u);
+        TS_ASSERT(better_enums::find_descriptor("Flag") == NULL);
+        TS_ASSERT_EQUALS(better_enums::count_descriptors("Moon"), 0u);
+#endif
+    }
+};
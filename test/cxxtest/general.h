@@ -140,7 +140,9 @@ static_assert_1((std::is_same<decltype(std::declval<std::ostream&>() << +Enum::O
 
 }
 
-#ifdef BETTER_ENUMS_CONSTEXPR_TO_STRING
+#if defined(BETTER_ENUMS_CONSTEXPR_TO_STRING) || \
+    (defined(BETTER_ENUMS_CONSTEXPR_NAMES) && \
+     defined(BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR))
 
 constexpr bool same_string(const char *r, const char *s, size_t index = 0)
 {
@@ -156,8 +158,21 @@ static_assert_1(Depth::_names().size() == 2);
 static_assert_1(same_string(*Depth::_names().begin(), "HighColor"));
 static_assert_1(same_string(*(Depth::_names().end() - 1), "TrueColor"));
 static_assert_1(same_string(Depth::_names()[0], "HighColor"));
+static_assert_1(same_string((+Compression::Default)._to_string(), "Huffman"));
 
-#endif // #ifdef BETTER_ENUMS_CONSTEXPR_TO_STRING
+#endif // #if defined(BETTER_ENUMS_CONSTEXPR_TO_STRING) || ...
+
+#ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
+
+SLOW_ENUM(PaperSize, int, InternationalStandardA4Paper = 4, Letter)
+
+static_assert_1((+PaperSize::InternationalStandardA4Paper)._to_string_length()
+                == 28);
+static_assert_1((+PaperSize::InternationalStandardA4Paper)._to_string()[27]
+                == 'r');
+static_assert_1(PaperSize::_names()[1][6] == '\0');
+
+#endif // #ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
 
 #endif // #ifdef _ENUM_HAVE_CONSTEXPR
 
@@ -431,4 +446,6 @@ class EnumTests : public CxxTest::TestSuite {
 BETTER_ENUM(InternalNameCollisions, int,
             EnumClassForSwitchStatements, PutNamesInThisScopeAlso,
             force_initialization, value_array, raw_names, name_storage,
-            name_array, initialized, the_raw_names, the_name_array)
+            name_array, initialized, the_raw_names, the_name_array,
+            trimmed_type, the_trimmed_names, the_name_pointers, name_at,
+            name_length)
@@ -0,0 +1,106 @@
+#include <cxxtest/TestSuite.h>
+#include <cstring>
+#include <enum.h>
+
+
+
+namespace instrumented {
+
+BETTER_ENUM(Signal, int, Red, Amber = 3, Green)
+
+}
+
+#if defined(BETTER_ENUMS_HAVE_CONSTEXPR) && \
+    (!defined(BETTER_ENUMS_INSTRUMENT) || \
+     defined(BETTER_ENUMS_HAVE_IS_CONSTANT_EVALUATED))
+
+static_assert(instrumented::Signal::_from_string("Green") ==
+              +instrumented::Signal::Green, "instrumented constexpr");
+static_assert(instrumented::Signal::_from_integral(3) ==
+              +instrumented::Signal::Amber, "instrumented constexpr");
+
+#endif
+
+
+
+class InstrumentTests : public CxxTest::TestSuite {
+  public:
+    void test_counts()
+    {
+#ifdef BETTER_ENUMS_INSTRUMENT
+        better_enums::conversion_counters   before =
+            better_enums::conversion_counters_of<instrumented::Signal>();
+
+        instrumented::Signal::_from_string_nothrow("Red");
+        instrumented::Signal::_from_string_nothrow("Blue");
+        instrumented::Signal::_from_string_nothrow("Gre", 3);
+        instrumented::Signal::_from_string_nocase_nothrow("green");
+        instrumented::Signal::_from_integral_nothrow(3);
+        instrumented::Signal::_from_integral_nothrow(5);
+        (+instrumented::Signal::Amber)._to_string();
+
+        better_enums::conversion_counters   after =
+            better_enums::conversion_counters_of<instrumented::Signal>();
+
+        TS_ASSERT_EQUALS(strcmp(after.type_name, "Signal"), 0);
+        TS_ASSERT_EQUALS(after.from_string - before.from_string, 3u);
+        TS_ASSERT_EQUALS(after.from_string_misses - before.from_string_misses,
+                         2u);
+        TS_ASSERT_EQUALS(after.from_string_nocase - before.from_string_nocase,
+                         1u);
+        TS_ASSERT_EQUALS(after.from_string_nocase_misses -
+                         before.from_string_nocase_misses, 0u);
+        TS_ASSERT_EQUALS(after.from_integral - before.from_integral, 2u);
+        TS_ASSERT_EQUALS(after.from_integral_misses -
+                         before.from_integral_misses, 1u);
+        TS_ASSERT_EQUALS(after.to_string - before.to_string, 1u);
+        TS_ASSERT_EQUALS(after.to_string_misses - before.to_string_misses, 0u);
+#endif
+    }
+
+    void test_bulk_counts()
+    {
+#ifdef BETTER_ENUMS_INSTRUMENT
+        better_enums::conversion_counters   before =
+            better_enums::conversion_counters_of<instrumented::Signal>();
+
+        const char                  *names[] = { "Red", "Green", "Blue" };
+        instrumented::Signal        values[] =
+            { instrumented::Signal::Red, instrumented::Signal::Red,
+              instrumented::Signal::Red };
+
+        better_enums::from_string_n(names, 3, values);
+
+        better_enums::conversion_counters   after =
+            better_enums::conversion_counters_of<instrumented::Signal>();
+
+        TS_ASSERT_EQUALS(after.from_string - before.from_string, 3u);
+        TS_ASSERT_EQUALS(after.from_string_misses - before.from_string_misses,
+                         1u);
+#endif
+    }
+
+    void test_snapshot()
+    {
+#ifdef BETTER_ENUMS_INSTRUMENT
+        better_enums::conversion_counters_of<instrumented::Signal>();
+
+        better_enums::conversion_counters   counters[64];
+        size_t                              count =
+            better_enums::snapshot_conversion_counters(counters, 64);
+
+        TS_ASSERT(count >= 1u);
+        TS_ASSERT(count <= 64u);
+        TS_ASSERT_EQUALS(better_enums::snapshot_conversion_counters(NULL, 0),
+                         count);
+
+        size_t  found = 0;
+        for (size_t index = 0; index < count; ++index) {
+            if (strcmp(counters[index].type_name, "Signal") == 0)
+                ++found;
+        }
+
+        TS_ASSERT_EQUALS(found, 1u);
+#endif
+    }
+};
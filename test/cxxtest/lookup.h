@@ -0,0 +1,596 @@
+#include <cxxtest/TestSuite.h>
+#include <cctype>
+#include <cstring>
+#include <iosfwd>
+#include <stdexcept>
+#include <string>
+#include <enum.h>
+
+
+
+namespace lookup {
+
+BETTER_ENUM(Consecutive, int, Minus = -1, Zero, One, Two)
+BETTER_ENUM(Dense, short, C = 3, A = 1, B = 2, E = 5, Alias = B)
+BETTER_ENUM(Sparse, int, Small = 1, Medium = 100, Large = 10000)
+BETTER_ENUM(Extremes, int, Lowest = -2147483647 - 1, Highest = 2147483647)
+BETTER_ENUM(Single, unsigned char, Only = 255)
+
+BETTER_ENUM(Method, int,
+            Get, Head, Post, Put = 10, Delete, Connect, Options = 20, Trace,
+            Patch, Propfind, Proppatch, Mkcol, Copy, Move, Lock, Unlock,
+            Search, Bind, Rebind, Unbind, Acl, Report, Mkactivity, Checkout,
+            Merge, Notify, Subscribe, Unsubscribe, Purge, Mkcalendar, Link,
+            Unlink, Source, Pri, Description, Query, Update, Label, Baseline,
+            Version)
+
+BETTER_ENUM(Cased, int, Other, Duplicate, DUPLICATE)
+
+BETTER_ENUM(Status, short,
+            Continue = 100, Switching = 101, Ok = 200, Created = 201,
+            Accepted = 202, NoContent = 204, Moved = 301, Found = 302,
+            NotModified = 304, BadRequest = 400, Unauthorized = 401,
+            Forbidden = 403, NotFound = 404, Conflict = 409, Gone = 410,
+            Teapot = 418, Error = 500, Unavailable = 503, Timeout = 504,
+            Redirect = 302)
+
+BETTER_ENUM(State, int, Idle, Running = 5, Stopped, Busy = Running, Failed)
+
+BETTER_ENUM(Nested, int, Red, RedLight = 4, Re, Blue, Shade = RedLight)
+BETTER_ENUM(Shuffled, int, Two = 2, Zero = 0, One = 1, Nil = Zero)
+
+}
+
+BETTER_ENUMS_DECLARE_HOT_CONSTANTS(lookup::Method, Version, Get, Post, Patch)
+BETTER_ENUMS_DECLARE_HOT_CONSTANTS(lookup::State, Failed, Busy)
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+static_assert(lookup::Method::_from_string("Put") == +lookup::Method::Put,
+              "compile-time name lookup");
+static_assert(!lookup::Method::_is_valid("Pu"), "compile-time name lookup");
+static_assert(lookup::Method::_from_string_nocase("pUT") ==
+                  +lookup::Method::Put, "compile-time name lookup");
+static_assert(lookup::Method::_from_string("PutX", 3) == +lookup::Method::Put,
+              "compile-time name lookup");
+static_assert(!lookup::Method::_is_valid("PutX", 4),
+              "compile-time name lookup");
+static_assert(lookup::Method::_from_string("Version") ==
+                  +lookup::Method::Version, "compile-time hot lookup");
+static_assert(lookup::State::_from_string("Busy") == +lookup::State::Running,
+              "compile-time hot lookup");
+static_assert(*lookup::Status::_from_integral_nothrow(503) ==
+                  +lookup::Status::Unavailable, "compile-time value lookup");
+static_assert(lookup::Dense::_max_value() == +lookup::Dense::E,
+              "compile-time value traits");
+static_assert(lookup::Shuffled::_is_contiguous(), "compile-time value traits");
+static_assert(!lookup::Shuffled::_is_sorted(), "compile-time value traits");
+
+#endif
+
+#if defined(BETTER_ENUMS_CONSTEXPR_TO_STRING) || \
+    (defined(BETTER_ENUMS_CONSTEXPR_NAMES) && \
+     defined(BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR))
+
+static_assert((+lookup::Method::Proppatch)._to_string_length() == 9,
+              "compile-time name length");
+
+#endif
+
+#ifdef BETTER_ENUMS_HAVE_STRING_VIEW
+
+static_assert(lookup::Method::_is_valid(std::string_view("Patch")),
+              "compile-time name lookup");
+
+#endif
+
+#ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
+
+static_assert(*better_enums::parse_prefix<lookup::Nested>(
+                  "RedLig", "RedLig" + 6).value == +lookup::Nested::Red,
+              "compile-time prefix parsing");
+static_assert(better_enums::parse_prefix<lookup::Method>(
+                  "Proppatch,", "Proppatch," + 10).length == 9,
+              "compile-time prefix parsing");
+
+#endif
+
+
+
+class ValueLookupTests : public CxxTest::TestSuite {
+  public:
+    void test_strategy()
+    {
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+        TS_ASSERT_EQUALS(lookup::Consecutive::_value_lookup_strategy(),
+                         better_enums::offset_lookup);
+        TS_ASSERT_EQUALS(lookup::Single::_value_lookup_strategy(),
+                         better_enums::offset_lookup);
+        TS_ASSERT_EQUALS(lookup::Dense::_value_lookup_strategy(),
+                         better_enums::table_lookup);
+        TS_ASSERT_EQUALS(lookup::Sparse::_value_lookup_strategy(),
+                         better_enums::linear_scan);
+        TS_ASSERT_EQUALS(lookup::Extremes::_value_lookup_strategy(),
+                         better_enums::linear_scan);
+#else
+        TS_ASSERT_EQUALS(lookup::Consecutive::_value_lookup_strategy(),
+                         better_enums::linear_scan);
+        TS_ASSERT_EQUALS(lookup::Dense::_value_lookup_strategy(),
+                         better_enums::linear_scan);
+#endif
+    }
+
+    void test_value_traits()
+    {
+        TS_ASSERT_EQUALS(lookup::Dense::_min_value(), +lookup::Dense::A);
+        TS_ASSERT_EQUALS(lookup::Dense::_max_value(), +lookup::Dense::E);
+        TS_ASSERT(!lookup::Dense::_is_contiguous());
+        TS_ASSERT(!lookup::Dense::_is_sorted());
+        TS_ASSERT_EQUALS(lookup::Dense::_density(), 1.0);
+
+        TS_ASSERT(lookup::Consecutive::_is_contiguous());
+        TS_ASSERT(lookup::Consecutive::_is_sorted());
+        TS_ASSERT(lookup::Single::_is_contiguous());
+        TS_ASSERT(lookup::Shuffled::_is_contiguous());
+        TS_ASSERT(!lookup::Shuffled::_is_sorted());
+
+        TS_ASSERT(!lookup::Sparse::_is_contiguous());
+        TS_ASSERT(lookup::Sparse::_is_sorted());
+        TS_ASSERT_EQUALS(lookup::Sparse::_density(), 3.0 / 10000);
+
+        TS_ASSERT_EQUALS(lookup::Extremes::_min_value(),
+                         +lookup::Extremes::Lowest);
+        TS_ASSERT_EQUALS(lookup::Extremes::_max_value(),
+                         +lookup::Extremes::Highest);
+        TS_ASSERT(!lookup::Extremes::_is_contiguous());
+        TS_ASSERT(lookup::Extremes::_is_sorted());
+
+        TS_ASSERT(!lookup::State::_is_contiguous());
+        TS_ASSERT(!lookup::State::_is_sorted());
+    }
+
+    void test_offset_lookup()
+    {
+        TS_ASSERT_EQUALS((+lookup::Consecutive::Minus)._to_index(), 0u);
+        TS_ASSERT_EQUALS((+lookup::Consecutive::Two)._to_index(), 3u);
+        TS_ASSERT_EQUALS(strcmp((+lookup::Consecutive::Zero)._to_string(),
+                                "Zero"), 0);
+
+        TS_ASSERT(lookup::Consecutive::_is_valid(-1));
+        TS_ASSERT(lookup::Consecutive::_is_valid(2));
+        TS_ASSERT(!lookup::Consecutive::_is_valid(-2));
+        TS_ASSERT(!lookup::Consecutive::_is_valid(3));
+        TS_ASSERT_EQUALS(lookup::Consecutive::_from_integral(1),
+                         +lookup::Consecutive::One);
+
+        TS_ASSERT_EQUALS(strcmp((+lookup::Single::Only)._to_string(), "Only"),
+                         0);
+        TS_ASSERT(!lookup::Single::_is_valid((lookup::Single::_integral)0));
+    }
+
+    void test_table_lookup()
+    {
+        TS_ASSERT_EQUALS((+lookup::Dense::C)._to_index(), 0u);
+        TS_ASSERT_EQUALS((+lookup::Dense::A)._to_index(), 1u);
+        TS_ASSERT_EQUALS((+lookup::Dense::B)._to_index(), 2u);
+        TS_ASSERT_EQUALS((+lookup::Dense::E)._to_index(), 3u);
+        TS_ASSERT_EQUALS((+lookup::Dense::Alias)._to_index(), 2u);
+        TS_ASSERT_EQUALS(strcmp((+lookup::Dense::Alias)._to_string(), "B"), 0);
+        TS_ASSERT_EQUALS(strcmp((+lookup::Dense::E)._to_string(), "E"), 0);
+
+        TS_ASSERT(lookup::Dense::_is_valid(1));
+        TS_ASSERT(lookup::Dense::_is_valid(5));
+        TS_ASSERT(!lookup::Dense::_is_valid((lookup::Dense::_integral)0));
+        TS_ASSERT(!lookup::Dense::_is_valid(4));
+        TS_ASSERT(!lookup::Dense::_is_valid(6));
+        TS_ASSERT_THROWS(lookup::Dense::_from_integral(4), std::runtime_error);
+    }
+
+    void test_linear_scan()
+    {
+        TS_ASSERT_EQUALS((+lookup::Sparse::Large)._to_index(), 2u);
+        TS_ASSERT(lookup::Sparse::_is_valid(100));
+        TS_ASSERT(!lookup::Sparse::_is_valid(2));
+
+        TS_ASSERT_EQUALS((+lookup::Extremes::Highest)._to_index(), 1u);
+        TS_ASSERT(
+            !lookup::Extremes::_is_valid((lookup::Extremes::_integral)0));
+        TS_ASSERT_EQUALS(strcmp((+lookup::Extremes::Lowest)._to_string(),
+                                "Lowest"), 0);
+    }
+
+    void test_blocked_scan()
+    {
+        for (std::size_t index = 0; index < lookup::Status::_size(); ++index) {
+            lookup::Status  value = lookup::Status::_values()[index];
+
+            TS_ASSERT(lookup::Status::_is_valid(value._to_integral()));
+            TS_ASSERT_EQUALS(
+                lookup::Status::_from_integral(value._to_integral()), value);
+        }
+
+        TS_ASSERT_EQUALS((+lookup::Status::Redirect)._to_index(), 7u);
+        TS_ASSERT_EQUALS((+lookup::Status::Timeout)._to_index(), 18u);
+        TS_ASSERT(!lookup::Status::_is_valid((lookup::Status::_integral)0));
+        TS_ASSERT(!lookup::Status::_is_valid((lookup::Status::_integral)505));
+        TS_ASSERT(!lookup::Status::_is_valid((lookup::Status::_integral)99));
+    }
+};
+
+class NameLookupTests : public CxxTest::TestSuite {
+  public:
+    void test_strategy()
+    {
+#if defined(BETTER_ENUMS_HAVE_CONSTEXPR) && defined(BETTER_ENUMS_HASH_NAMES)
+        TS_ASSERT_EQUALS(lookup::Method::_name_lookup_strategy(),
+                         better_enums::hash_lookup);
+#else
+        TS_ASSERT_EQUALS(lookup::Method::_name_lookup_strategy(),
+                         better_enums::linear_scan);
+#endif
+    }
+
+    void test_every_name()
+    {
+        for (std::size_t index = 0; index < lookup::Method::_size(); ++index) {
+            const char  *name = lookup::Method::_names()[index];
+
+            TS_ASSERT(lookup::Method::_is_valid(name));
+            TS_ASSERT_EQUALS(lookup::Method::_from_string(name),
+                             lookup::Method::_values()[index]);
+        }
+    }
+
+    void test_mismatches()
+    {
+        TS_ASSERT(!lookup::Method::_is_valid(""));
+        TS_ASSERT(!lookup::Method::_is_valid("get"));
+        TS_ASSERT(!lookup::Method::_is_valid("Ge"));
+        TS_ASSERT(!lookup::Method::_is_valid("Gets"));
+        TS_ASSERT(!lookup::Method::_is_valid("Put = 10"));
+        TS_ASSERT(!lookup::Method::_from_string_nothrow("Options "));
+        TS_ASSERT_THROWS(lookup::Method::_from_string("Trace\t"),
+                         std::runtime_error);
+    }
+
+    void test_initialized_constants()
+    {
+        TS_ASSERT_EQUALS(lookup::Method::_from_string("Options"),
+                         +lookup::Method::Options);
+        TS_ASSERT_EQUALS(*lookup::Dense::_from_string_nothrow("Alias"),
+                         +lookup::Dense::B);
+    }
+
+    void test_nocase()
+    {
+        for (std::size_t index = 0; index < lookup::Method::_size(); ++index) {
+            std::string upper(lookup::Method::_names()[index]);
+            std::string lower(upper);
+
+            for (std::size_t c = 0; c < upper.size(); ++c) {
+                upper[c] = (char)toupper(upper[c]);
+                lower[c] = (char)tolower(lower[c]);
+            }
+
+            TS_ASSERT(lookup::Method::_is_valid_nocase(upper.c_str()));
+            TS_ASSERT_EQUALS(lookup::Method::_from_string_nocase(lower.c_str()),
+                             lookup::Method::_values()[index]);
+        }
+
+        TS_ASSERT(!lookup::Method::_is_valid_nocase(""));
+        TS_ASSERT(!lookup::Method::_is_valid_nocase("gett"));
+        TS_ASSERT(!lookup::Method::_is_valid_nocase("PUT = 10"));
+        TS_ASSERT(!lookup::Method::_from_string_nocase_nothrow("ge"));
+        TS_ASSERT_EQUALS(*lookup::Dense::_from_string_nocase_nothrow("alias"),
+                         +lookup::Dense::B);
+    }
+
+    void test_hot_constants()
+    {
+        for (std::size_t index = 0; index < lookup::State::_size(); ++index) {
+            const char  *name = lookup::State::_names()[index];
+
+            TS_ASSERT_EQUALS(lookup::State::_from_string(name),
+                             lookup::State::_values()[index]);
+            TS_ASSERT_EQUALS(lookup::State::_from_string(name, strlen(name)),
+                             lookup::State::_values()[index]);
+        }
+
+        TS_ASSERT_EQUALS(lookup::State::_from_string("Failed"),
+                         +lookup::State::Failed);
+        TS_ASSERT_EQUALS(lookup::State::_from_string("BusyX", 4),
+                         +lookup::State::Running);
+        TS_ASSERT(!lookup::State::_is_valid("Fail"));
+        TS_ASSERT(!lookup::State::_is_valid("FailedX", 7));
+        TS_ASSERT_EQUALS(lookup::State::_from_string_nocase("failed"),
+                         +lookup::State::Failed);
+        TS_ASSERT_EQUALS(lookup::Method::_from_string("Patch"),
+                         +lookup::Method::Patch);
+    }
+
+    void test_nocase_first_match()
+    {
+        TS_ASSERT_EQUALS(lookup::Cased::_from_string_nocase("DUPLICATE"),
+                         +lookup::Cased::Duplicate);
+        TS_ASSERT_EQUALS(lookup::Cased::_from_string("DUPLICATE"),
+                         +lookup::Cased::DUPLICATE);
+    }
+};
+
+class LengthLookupTests : public CxxTest::TestSuite {
+  public:
+    void test_every_name()
+    {
+        for (std::size_t index = 0; index < lookup::Method::_size(); ++index) {
+            std::string buffer(lookup::Method::_names()[index]);
+            std::size_t length = buffer.size();
+            buffer += "Get";
+
+            TS_ASSERT(lookup::Method::_is_valid(buffer.data(), length));
+            TS_ASSERT_EQUALS(
+                lookup::Method::_from_string(buffer.data(), length),
+                lookup::Method::_values()[index]);
+            TS_ASSERT_EQUALS(
+                lookup::Method::_from_string_nocase(buffer.data(), length),
+                lookup::Method::_values()[index]);
+        }
+    }
+
+    void test_unterminated()
+    {
+        const char  buffer[] = { 'P', 'u', 't', 'G', 'e', 't' };
+
+        TS_ASSERT_EQUALS(lookup::Method::_from_string(buffer, 3),
+                         +lookup::Method::Put);
+        TS_ASSERT_EQUALS(lookup::Method::_from_string(buffer + 3, 3),
+                         +lookup::Method::Get);
+        TS_ASSERT_EQUALS(*lookup::Method::_from_string_nothrow(buffer, 3),
+                         +lookup::Method::Put);
+        TS_ASSERT(lookup::Method::_is_valid_nocase("pUtX", 3));
+        TS_ASSERT_EQUALS(*lookup::Method::_from_string_nocase_nothrow("GET", 3),
+                         +lookup::Method::Get);
+    }
+
+    void test_mismatches()
+    {
+        TS_ASSERT(!lookup::Method::_is_valid("Put", 0));
+        TS_ASSERT(!lookup::Method::_is_valid("Put", 2));
+        TS_ASSERT(!lookup::Method::_is_valid("Put\0", 4));
+        TS_ASSERT(!lookup::Method::_is_valid("Put = 10", 8));
+        TS_ASSERT(!lookup::Method::_is_valid("put", 3));
+        TS_ASSERT(!lookup::Method::_is_valid_nocase("PUTX", 4));
+        TS_ASSERT(!lookup::Method::_from_string_nothrow("Options ", 8));
+        TS_ASSERT_THROWS(lookup::Method::_from_string("Trace", 4),
+                         std::runtime_error);
+        TS_ASSERT_THROWS(lookup::Method::_from_string_nocase("trace", 6),
+                         std::runtime_error);
+    }
+
+    void test_long_strings()
+    {
+        std::string long_name(100000, 'A');
+
+        TS_ASSERT(!lookup::Method::_is_valid(long_name.c_str()));
+        TS_ASSERT(!lookup::Method::_is_valid_nocase(long_name.c_str()));
+        TS_ASSERT(!lookup::Method::_is_valid(long_name.data(),
+                                             long_name.size()));
+    }
+
+    void test_string_view()
+    {
+#ifdef BETTER_ENUMS_HAVE_STRING_VIEW
+        std::string_view    view("DeleteConnect");
+
+        TS_ASSERT_EQUALS(lookup::Method::_from_string(view.substr(0, 6)),
+                         +lookup::Method::Delete);
+        TS_ASSERT_EQUALS(lookup::Method::_from_string_nocase(view.substr(6)),
+                         +lookup::Method::Connect);
+        TS_ASSERT(lookup::Method::_is_valid(view.substr(6)));
+        TS_ASSERT(!lookup::Method::_is_valid(view));
+        TS_ASSERT(!lookup::Method::_is_valid_nocase(view.substr(0, 5)));
+        TS_ASSERT(!lookup::Method::_from_string_nothrow(view.substr(1, 5)));
+        TS_ASSERT_EQUALS(*lookup::Method::_from_string_nocase_nothrow(
+                             std::string_view("GET")),
+                         +lookup::Method::Get);
+#endif
+    }
+};
+
+class NameLengthTests : public CxxTest::TestSuite {
+  public:
+    void test_every_name()
+    {
+        for (std::size_t index = 0; index < lookup::Method::_size(); ++index) {
+            lookup::Method  value = lookup::Method::_values()[index];
+
+            TS_ASSERT_EQUALS(value._to_string_length(),
+                             std::string(value._to_string()).size());
+        }
+    }
+
+    void test_aliases()
+    {
+        TS_ASSERT_EQUALS((+lookup::Dense::Alias)._to_string_length(), 1u);
+        TS_ASSERT_EQUALS((+lookup::Cased::DUPLICATE)._to_string_length(), 9u);
+    }
+
+    void test_invalid()
+    {
+        TS_ASSERT_EQUALS(
+            lookup::Sparse::_from_integral_unchecked(2)._to_string_length(),
+            0u);
+    }
+
+    void test_string_view()
+    {
+#ifdef BETTER_ENUMS_HAVE_STRING_VIEW
+        TS_ASSERT_EQUALS((+lookup::Method::Mkcalendar)._to_string_view(),
+                         "Mkcalendar");
+        TS_ASSERT_EQUALS((+lookup::Extremes::Lowest)._to_string_view().size(),
+                         6u);
+        TS_ASSERT(
+            lookup::Sparse::_from_integral_unchecked(2)._to_string_view()
+                .empty());
+#endif
+    }
+};
+
+class BulkConversionTests : public CxxTest::TestSuite {
+  public:
+    void test_from_integral_n()
+    {
+        const int       integrals[] = { 100, 1, 3, 10000, 1, 7 };
+        lookup::Sparse  values[6] =
+            { lookup::Sparse::Small, lookup::Sparse::Small,
+              lookup::Sparse::Small, lookup::Sparse::Small,
+              lookup::Sparse::Small, lookup::Sparse::Small };
+
+        TS_ASSERT_EQUALS(better_enums::from_integral_n(integrals, 6, values),
+                         2u);
+        TS_ASSERT_EQUALS(values[0], +lookup::Sparse::Medium);
+        TS_ASSERT_EQUALS(values[1], +lookup::Sparse::Small);
+        TS_ASSERT_EQUALS(values[3], +lookup::Sparse::Large);
+        TS_ASSERT_EQUALS(values[4], +lookup::Sparse::Small);
+
+        TS_ASSERT_EQUALS(better_enums::from_integral_n(integrals, 2, values),
+                         2u);
+    }
+
+    void test_to_index_n()
+    {
+        const lookup::Dense values[] =
+            { lookup::Dense::E, lookup::Dense::Alias, lookup::Dense::C,
+              lookup::Dense::_from_integral_unchecked(4) };
+        std::size_t         indices[4];
+
+        TS_ASSERT_EQUALS(better_enums::to_index_n(values, 4, indices), 3u);
+        TS_ASSERT_EQUALS(indices[0], 3u);
+        TS_ASSERT_EQUALS(indices[1], 2u);
+        TS_ASSERT_EQUALS(indices[2], 0u);
+        TS_ASSERT_EQUALS(indices[3], lookup::Dense::_size());
+    }
+
+    void test_to_string_n()
+    {
+        const lookup::Method    values[] =
+            { lookup::Method::Version, lookup::Method::Get,
+              lookup::Method::_from_integral_unchecked(5),
+              lookup::Method::Trace };
+        const char              *names[4];
+
+        TS_ASSERT_EQUALS(better_enums::to_string_n(values, 4, names), 2u);
+        TS_ASSERT_EQUALS(std::string(names[0]), "Version");
+        TS_ASSERT_EQUALS(std::string(names[1]), "Get");
+        TS_ASSERT(names[2] == NULL);
+        TS_ASSERT_EQUALS(std::string(names[3]), "Trace");
+    }
+
+    void test_from_string_n()
+    {
+        const char * const  names[] = { "Post", "Mkcol", "post", "Trace" };
+        lookup::Method      values[4] =
+            { lookup::Method::Get, lookup::Method::Get, lookup::Method::Get,
+              lookup::Method::Get };
+
+        TS_ASSERT_EQUALS(better_enums::from_string_n(names, 4, values), 2u);
+        TS_ASSERT_EQUALS(values[0], +lookup::Method::Post);
+        TS_ASSERT_EQUALS(values[1], +lookup::Method::Mkcol);
+        TS_ASSERT_EQUALS(values[2], +lookup::Method::Get);
+        TS_ASSERT_EQUALS(values[3], +lookup::Method::Trace);
+    }
+
+    void test_validate_n()
+    {
+        const int       integrals[] =
+            { 1, 2, 100, 10000, 0, 100, 1, 1, 10001, 1 };
+        unsigned char   invalid[2] = { 0xff, 0xff };
+
+        TS_ASSERT_EQUALS(
+            better_enums::validate_n<lookup::Sparse>(integrals, 10), 1u);
+        TS_ASSERT_EQUALS(
+            better_enums::validate_n<lookup::Sparse>(integrals + 2, 2), 2u);
+        TS_ASSERT_EQUALS(
+            better_enums::validate_n<lookup::Sparse>(integrals, 10, invalid),
+            1u);
+        TS_ASSERT_EQUALS(invalid[0], 0x12);
+        TS_ASSERT_EQUALS(invalid[1], 0x01);
+    }
+
+    void test_duplicate_values()
+    {
+        const short     integrals[] = { 2, 5, 2 };
+        lookup::Dense   values[3] =
+            { lookup::Dense::C, lookup::Dense::C, lookup::Dense::C };
+        const char      *names[3];
+
+        better_enums::from_integral_n(integrals, 3, values);
+        better_enums::to_string_n(values, 3, names);
+
+        TS_ASSERT_EQUALS(std::string(names[0]), "B");
+        TS_ASSERT_EQUALS(std::string(names[2]), "B");
+    }
+};
+
+
+
+class PrefixParsingTests : public CxxTest::TestSuite {
+  public:
+    void test_longest_match()
+    {
+        const char  *input = "RedLight\tRe,Reed,Blu";
+        const char  *end = input + strlen(input);
+
+        better_enums::prefix_match<lookup::Nested>  match =
+            better_enums::parse_prefix<lookup::Nested>(input, end);
+
+        TS_ASSERT_EQUALS(match.length, 8u);
+        TS_ASSERT_EQUALS(*match.value, +lookup::Nested::RedLight);
+
+        match = better_enums::parse_prefix<lookup::Nested>(input + 9, end);
+        TS_ASSERT_EQUALS(match.length, 2u);
+        TS_ASSERT_EQUALS(*match.value, +lookup::Nested::Re);
+
+        match = better_enums::parse_prefix<lookup::Nested>(input + 12, end);
+        TS_ASSERT_EQUALS(match.length, 2u);
+        TS_ASSERT_EQUALS(*match.value, +lookup::Nested::Re);
+
+        match = better_enums::parse_prefix<lookup::Nested>(input + 17, end);
+        TS_ASSERT_EQUALS(match.length, 0u);
+        TS_ASSERT(!match.value);
+    }
+
+    void test_bounds()
+    {
+        const char  *input = "RedLight";
+
+        better_enums::prefix_match<lookup::Nested>  match =
+            better_enums::parse_prefix<lookup::Nested>(input, input + 5);
+
+        TS_ASSERT_EQUALS(match.length, 3u);
+        TS_ASSERT_EQUALS(*match.value, +lookup::Nested::Red);
+
+        match = better_enums::parse_prefix<lookup::Nested>(input, input);
+        TS_ASSERT_EQUALS(match.length, 0u);
+        TS_ASSERT(!match.value);
+
+        const char  *alias = "Shade";
+
+        match = better_enums::parse_prefix<lookup::Nested>(alias, alias + 5);
+        TS_ASSERT_EQUALS(*match.value, +lookup::Nested::RedLight);
+    }
+
+    void test_every_name()
+    {
+        for (size_t index = 0; index < lookup::Method::_size(); ++index) {
+            const char  *name = lookup::Method::_names()[index];
+            std::string text = std::string(name) + " rest";
+
+            better_enums::prefix_match<lookup::Method>  match =
+                better_enums::parse_prefix<lookup::Method>(
+                    text.data(), text.data() + text.size());
+
+            TS_ASSERT_EQUALS(match.length, strlen(name));
+            TS_ASSERT_EQUALS(*match.value, lookup::Method::_values()[index]);
+        }
+    }
+};
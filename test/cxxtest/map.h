@@ -0,0 +1,92 @@
+#include <cxxtest/TestSuite.h>
+#include <cstring>
+#include <stdexcept>
+#include <enum.h>
+
+
+
+namespace maps {
+
+BETTER_ENUM(Level, int, Debug = 10, Info = 20, Warning = 30, Error = 40,
+            Fatal = 50, Critical = Fatal)
+
+inline const char* describe(Level level)
+{
+    static const char   *names[] =
+        { "debug", "info", "warning", "error", "fatal" };
+
+    return names[level._to_integral() / 10 - 1];
+}
+
+inline int syslog_code(Level level)
+{
+    static const int    codes[] = { 7, 6, 4, 3, 2 };
+
+    return codes[level._to_integral() / 10 - 1];
+}
+
+inline int severity(Level level)
+{
+    return level == +Level::Debug ? 0 : 1;
+}
+
+}
+
+
+
+class TableMapTests : public CxxTest::TestSuite {
+  public:
+    void test_from_enum()
+    {
+        better_enums::table_map<maps::Level, const char*>   names =
+            better_enums::make_table_map(maps::describe);
+
+        TS_ASSERT_EQUALS(strcmp(names.from_enum(maps::Level::Warning),
+                                "warning"), 0);
+        TS_ASSERT_EQUALS(strcmp(names[maps::Level::Critical], "fatal"), 0);
+        TS_ASSERT_EQUALS(strcmp(names[maps::Level::Debug], "debug"), 0);
+    }
+
+    void test_to_enum_strings()
+    {
+        better_enums::table_map<maps::Level, const char*>   names =
+            better_enums::make_table_map(maps::describe);
+
+        for (size_t index = 0; index < maps::Level::_size(); ++index) {
+            maps::Level level = maps::Level::_values()[index];
+            char        copy[16];
+
+            strcpy(copy, maps::describe(level));
+            TS_ASSERT_EQUALS(names.to_enum(copy), level);
+        }
+
+        TS_ASSERT(!names.to_enum_nothrow("trace"));
+        TS_ASSERT(!names.to_enum_nothrow(""));
+        TS_ASSERT_THROWS(names.to_enum("zzz"), std::runtime_error);
+    }
+
+    void test_to_enum_integers()
+    {
+        better_enums::table_map<maps::Level, int>   codes =
+            better_enums::make_table_map(maps::syslog_code);
+
+        TS_ASSERT_EQUALS(codes[maps::Level::Info], 6);
+        TS_ASSERT_EQUALS(codes.to_enum(3), +maps::Level::Error);
+        TS_ASSERT_EQUALS(codes.to_enum(7), +maps::Level::Debug);
+        TS_ASSERT(!codes.to_enum_nothrow(5));
+        TS_ASSERT(!codes.to_enum_nothrow(8));
+        TS_ASSERT(!codes.to_enum_nothrow(0));
+    }
+
+    void test_agrees_with_map()
+    {
+        better_enums::table_map<maps::Level, int>   table =
+            better_enums::make_table_map(maps::severity);
+        better_enums::map<maps::Level, int>         scanned =
+            better_enums::make_map(maps::severity);
+
+        TS_ASSERT_EQUALS(table.to_enum(1), scanned.to_enum(1));
+        TS_ASSERT_EQUALS(table.to_enum(1), +maps::Level::Info);
+        TS_ASSERT_EQUALS(table.to_enum(0), scanned.to_enum(0));
+    }
+};
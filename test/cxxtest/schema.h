@@ -0,0 +1,186 @@
+#include <cxxtest/TestSuite.h>
+#include <cstring>
+#include <enum.h>
+#include <better-enums/schema.h>
+
+
+
+namespace schemas {
+
+BETTER_ENUM(Channel, unsigned char, Red, Green = 4, Blue)
+BETTER_ENUM(Offset, short, Back = -3, Here = 0, Forward = 3, Ahead = Forward)
+BETTER_ENUM(Sparse, int, Red = -2000000, Blue = 2000000, Green = 0)
+
+}
+
+// Newer and older versions of Channel, as other processes might declare them.
+namespace newer {
+
+BETTER_ENUM(Channel, int, Alpha = 100, Blue = 8, Red, Green = 9)
+
+}
+
+namespace older {
+
+BETTER_ENUM(Channel, short, Blue = -7)
+
+}
+
+#ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
+
+constexpr better_enums::schema_text<schemas::Channel>  channel_schema;
+
+static_assert(channel_schema.size() ==
+              better_enums::write_schema<schemas::Channel>(nullptr, 0),
+              "constexpr schema");
+static_assert(channel_schema.c_str()[0] == 'C', "constexpr schema");
+static_assert(channel_schema.c_str()[channel_schema.size() - 1] == '\n',
+              "constexpr schema");
+
+#endif
+
+
+
+class SchemaTests : public CxxTest::TestSuite {
+  public:
+    void test_write()
+    {
+        char        buffer[128];
+        const char  *expected = "Offset\nint16\n4 ";
+
+        size_t      length =
+            better_enums::write_schema<schemas::Offset>(buffer, sizeof(buffer));
+
+        TS_ASSERT_EQUALS(length, strlen(buffer));
+        TS_ASSERT_EQUALS(strncmp(buffer, expected, strlen(expected)), 0);
+        TS_ASSERT_EQUALS(strcmp(buffer + strlen(expected) + 8,
+                                "\nBack -3\nHere 0\nForward 3\nAhead 3\n"), 0);
+
+        better_enums::write_schema<schemas::Channel>(buffer, sizeof(buffer));
+        TS_ASSERT_EQUALS(strncmp(buffer, "Channel\nuint8\n3 ", 16), 0);
+    }
+
+    void test_truncate()
+    {
+        char        buffer[8];
+        size_t      length =
+            better_enums::write_schema<schemas::Channel>(BETTER_ENUMS_NULLPTR,
+                                                         0);
+
+        TS_ASSERT_EQUALS(
+            better_enums::write_schema<schemas::Channel>(buffer,
+                                                         sizeof(buffer)),
+            length);
+        TS_ASSERT_EQUALS(strcmp(buffer, "Channel"), 0);
+
+#ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
+        char        whole[64];
+
+        better_enums::write_schema<schemas::Channel>(whole, sizeof(whole));
+        TS_ASSERT_EQUALS(strcmp(channel_schema.c_str(), whole), 0);
+#endif
+    }
+
+    void test_remap_text()
+    {
+        char                                    peer[128];
+        better_enums::schema_remap<schemas::Channel>    remap;
+
+        better_enums::write_schema<newer::Channel>(peer, sizeof(peer));
+        TS_ASSERT(remap.load(peer));
+
+        TS_ASSERT_EQUALS(remap.unmatched(), 1u);
+        TS_ASSERT_EQUALS(*remap.to_local(8), +schemas::Channel::Blue);
+        TS_ASSERT_EQUALS(*remap.to_local(9), +schemas::Channel::Red);
+        TS_ASSERT(!remap.to_local(100));
+        TS_ASSERT(!remap.to_local(10));
+        TS_ASSERT(!remap.to_local(-1));
+    }
+
+    void test_remap_descriptor()
+    {
+        better_enums::schema_remap<schemas::Channel>    remap;
+
+        remap.load(better_enums::describe<schemas::Sparse>());
+
+        TS_ASSERT_EQUALS(remap.unmatched(), 0u);
+        TS_ASSERT_EQUALS(*remap.to_local(-2000000), +schemas::Channel::Red);
+        TS_ASSERT_EQUALS(*remap.to_local(2000000), +schemas::Channel::Blue);
+        TS_ASSERT_EQUALS(*remap.to_local(0), +schemas::Channel::Green);
+        TS_ASSERT(!remap.to_local(1));
+
+        remap.load(better_enums::describe<schemas::Offset>());
+        TS_ASSERT_EQUALS(remap.unmatched(), 4u);
+        TS_ASSERT(!remap.to_local(0));
+    }
+
+    void test_malformed()
+    {
+        better_enums::schema_remap<schemas::Channel>    remap;
+
+        TS_ASSERT(!remap.load(""));
+        TS_ASSERT(!remap.load("Channel\nuint8\n"));
+        TS_ASSERT(!remap.load("Channel\nuint8\n2 00000000\nRed 0\n"));
+        TS_ASSERT(!remap.load("Channel\nuint8\n1 00000000\nRed x\n"));
+        TS_ASSERT(!remap.to_local(0));
+
+        char        peer[64];
+
+        better_enums::write_schema<older::Channel>(peer, sizeof(peer));
+        TS_ASSERT(remap.load(peer));
+        TS_ASSERT_EQUALS(*remap.to_local(-7), +schemas::Channel::Blue);
+    }
+
+    void test_truncated()
+    {
+        better_enums::schema_remap<schemas::Channel>    remap;
+        char                                            peer[128];
+        size_t                                          length =
+            better_enums::write_schema<newer::Channel>(peer, sizeof(peer));
+
+        peer[length - 1] = '\0';
+        TS_ASSERT(!remap.load(peer));
+        peer[length - 3] = '\0';
+        TS_ASSERT(!remap.load(peer));
+        TS_ASSERT(!remap.to_local(8));
+
+        better_enums::write_schema<newer::Channel>(peer, sizeof(peer));
+        peer[length] = 'x';
+        peer[length + 1] = '\0';
+        TS_ASSERT(!remap.load(peer));
+    }
+
+    void test_oversized()
+    {
+        better_enums::schema_remap<schemas::Channel>    remap;
+
+        TS_ASSERT(!remap.load("Channel\nuint8\n4000000000000 0\n"));
+        TS_ASSERT(!remap.load("Channel\nuint8\n4000000000000 0\nRed 0\n"));
+        TS_ASSERT(!remap.load(
+            "Channel\nuint8\n100000000000000000000000000000001 0\nRed 0\n"));
+        TS_ASSERT(!remap.load("Channel\nuint8\n1 1000000000\nRed 0\n"));
+    }
+
+    void test_mismatched()
+    {
+        better_enums::schema_remap<schemas::Channel>    remap;
+        char                                            peer[128];
+
+        TS_ASSERT(!remap.load("Other\nint64\n1 deadbeef\nRed 7\n"));
+        TS_ASSERT(!remap.load("Chan\nuint8\n0 811c9dc5\n"));
+        TS_ASSERT(remap.load("Channel\nuint8\n0 811c9dc5\n"));
+
+        better_enums::write_schema<newer::Channel>(peer, sizeof(peer));
+        TS_ASSERT(remap.load(peer));
+
+        char        *value = strstr(peer, "Alpha 100");
+
+        value[8] = '1';
+        TS_ASSERT(!remap.load(peer));
+        TS_ASSERT(!remap.to_local(8));
+
+        value[8] = '0';
+        value[0] = 'B';
+        TS_ASSERT(!remap.load(peer));
+    }
+};
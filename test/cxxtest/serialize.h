@@ -0,0 +1,99 @@
+#include <cxxtest/TestSuite.h>
+#include <enum.h>
+#include <better-enums/schema.h>
+
+
+
+namespace serialize {
+
+BETTER_ENUM(Level, signed char, Low = -1, High = 1)
+BETTER_ENUM(Moved, signed char, Low = -1, High = 2)
+BETTER_ENUM(Renamed, signed char, Lowest = -1, High = 1)
+BETTER_ENUM(Flags, unsigned int, None, Huge = 4000000000u)
+BETTER_ENUM(Color, int, Red = 10, Green = 20, Blue = 30, Crimson = Red)
+
+}
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+static_assert(better_enums::encode_index(+serialize::Color::Blue) == 2,
+              "constexpr serialization");
+static_assert(*better_enums::decode_index<serialize::Color>(1) ==
+              +serialize::Color::Green, "constexpr serialization");
+static_assert(!better_enums::decode_index<serialize::Color>(4),
+              "constexpr serialization");
+static_assert(better_enums::schema_fingerprint<serialize::Level>() ==
+              0x33f220a4u, "constexpr serialization");
+
+#endif
+
+
+
+class SerializationTests : public CxxTest::TestSuite {
+  public:
+    void test_width()
+    {
+        TS_ASSERT_EQUALS(
+            sizeof(better_enums::serialized_index<serialize::Color>::type), 1u);
+    }
+
+    void test_round_trip()
+    {
+        for (size_t index = 0; index < serialize::Color::_size(); ++index) {
+            serialize::Color    value = serialize::Color::_values()[index];
+            better_enums::serialized_index<serialize::Color>::type  encoded =
+                better_enums::encode_index(value);
+
+            TS_ASSERT_EQUALS(
+                *better_enums::decode_index<serialize::Color>(encoded), value);
+            TS_ASSERT_EQUALS(
+                better_enums::decode_index_unchecked<serialize::Color>(encoded),
+                value);
+        }
+
+        TS_ASSERT_EQUALS(better_enums::encode_index(+serialize::Color::Crimson),
+                         0);
+        TS_ASSERT(!better_enums::decode_index<serialize::Color>(4));
+        TS_ASSERT(!better_enums::decode_index<serialize::Color>(255));
+    }
+
+    void test_validate()
+    {
+        unsigned char   column[200];
+
+        for (size_t position = 0; position < 200; ++position)
+            column[position] = static_cast<unsigned char>(position % 4);
+
+        TS_ASSERT_EQUALS(
+            better_enums::validate_indices<serialize::Color>(column, 200),
+            200u);
+        TS_ASSERT_EQUALS(
+            better_enums::validate_indices<serialize::Color>(column, 0), 0u);
+
+        column[150] = 4;
+        column[199] = 9;
+        TS_ASSERT_EQUALS(
+            better_enums::validate_indices<serialize::Color>(column, 200),
+            150u);
+        TS_ASSERT_EQUALS(
+            better_enums::validate_indices<serialize::Color>(column, 150),
+            150u);
+
+        column[3] = 200;
+        TS_ASSERT_EQUALS(
+            better_enums::validate_indices<serialize::Color>(column, 200), 3u);
+    }
+
+    void test_fingerprint()
+    {
+        TS_ASSERT_EQUALS(better_enums::schema_fingerprint<serialize::Level>(),
+                         0x33f220a4u);
+        TS_ASSERT_EQUALS(better_enums::schema_fingerprint<serialize::Moved>(),
+                         0x4c163e07u);
+        TS_ASSERT_DIFFERS(
+            better_enums::schema_fingerprint<serialize::Renamed>(),
+            better_enums::schema_fingerprint<serialize::Level>());
+        TS_ASSERT_EQUALS(better_enums::schema_fingerprint<serialize::Flags>(),
+                         0x3565ee27u);
+    }
+};
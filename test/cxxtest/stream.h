@@ -1,11 +1,25 @@
 #include <cxxtest/TestSuite.h>
 #include <iostream>
+#include <sstream>
+#include <string>
 #include <enum.h>
 
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+#   include <version>
+#endif
+
+#ifdef __cpp_lib_format
+#   include <format>
+#endif
+
 
 
 BETTER_ENUM(Compiler, int, GCC, Clang, MSVC)
 
+#ifdef __cpp_lib_format
+BETTER_ENUMS_DECLARE_STD_FORMATTER(Compiler)
+#endif
+
 
 
 class StreamOperatorTests : public CxxTest::TestSuite {
@@ -26,4 +40,130 @@ class StreamOperatorTests : public CxxTest::TestSuite {
         stream >> compiler;
         TS_ASSERT_EQUALS(compiler, +Compiler::Clang);
     }
+
+    void test_input_sequence()
+    {
+        std::stringstream   stream("  GCC\tMSVC\nClang");
+        Compiler            compiler = Compiler::GCC;
+
+        stream >> compiler;
+        TS_ASSERT_EQUALS(compiler, +Compiler::GCC);
+        stream >> compiler;
+        TS_ASSERT_EQUALS(compiler, +Compiler::MSVC);
+        stream >> compiler;
+        TS_ASSERT_EQUALS(compiler, +Compiler::Clang);
+        TS_ASSERT(!stream.fail());
+
+        stream >> compiler;
+        TS_ASSERT(stream.fail());
+        TS_ASSERT_EQUALS(compiler, +Compiler::Clang);
+    }
+
+    void test_input_mismatch()
+    {
+        std::stringstream   stream("Clan");
+        Compiler            compiler = Compiler::GCC;
+
+        stream >> compiler;
+        TS_ASSERT(stream.fail());
+        TS_ASSERT_EQUALS(compiler, +Compiler::GCC);
+    }
+
+    void test_input_too_long()
+    {
+        std::string         token(10000, 'G');
+        std::stringstream   stream(token + " GCC");
+        Compiler            compiler = Compiler::MSVC;
+
+        stream >> compiler;
+        TS_ASSERT(stream.fail());
+        TS_ASSERT_EQUALS(compiler, +Compiler::MSVC);
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+        std::string         rest;
+
+        stream.clear();
+        stream >> rest;
+        TS_ASSERT_EQUALS(rest.size(), token.size() - 6);
+#endif
+
+        std::stringstream   suffixed("GCCGCC");
+
+        suffixed >> compiler;
+        TS_ASSERT(suffixed.fail());
+    }
+
+    void test_input_width()
+    {
+        std::stringstream   stream("MSVCGCC");
+        Compiler            compiler = Compiler::GCC;
+
+        stream.width(4);
+        stream >> compiler;
+        TS_ASSERT(!stream.fail());
+        TS_ASSERT_EQUALS(compiler, +Compiler::MSVC);
+        TS_ASSERT_EQUALS(stream.width(), 0);
+
+        stream >> compiler;
+        TS_ASSERT_EQUALS(compiler, +Compiler::GCC);
+    }
+
+    void test_wide_output()
+    {
+        std::wstringstream  stream;
+
+        stream << +Compiler::MSVC;
+        TS_ASSERT(stream.str() == L"MSVC");
+    }
+
+    void test_wide_input()
+    {
+        std::wstringstream  stream(L"Clang MSVC");
+        Compiler            compiler = Compiler::GCC;
+
+        stream >> compiler;
+        TS_ASSERT_EQUALS(compiler, +Compiler::Clang);
+        stream >> compiler;
+        TS_ASSERT_EQUALS(compiler, +Compiler::MSVC);
+        TS_ASSERT(!stream.fail());
+
+        std::wstringstream  mismatch(L"GC\x0100");
+
+        mismatch >> compiler;
+        TS_ASSERT(mismatch.fail());
+        TS_ASSERT_EQUALS(compiler, +Compiler::MSVC);
+    }
+
+    void test_to_chars()
+    {
+        char                            buffer[8] = "xxxxxxx";
+        better_enums::to_chars_result   result =
+            better_enums::to_chars(buffer, buffer + 8, +Compiler::Clang);
+
+        TS_ASSERT(result.ok);
+        TS_ASSERT_EQUALS(result.ptr, buffer + 5);
+        TS_ASSERT_EQUALS(strcmp(buffer, "Clangxx"), 0);
+
+        result =
+            better_enums::to_chars(result.ptr, buffer + 8, +Compiler::MSVC);
+        TS_ASSERT(!result.ok);
+        TS_ASSERT_EQUALS(result.ptr, buffer + 8);
+        TS_ASSERT_EQUALS(strcmp(buffer, "Clangxx"), 0);
+
+        result = better_enums::to_chars(buffer, buffer + 8,
+                                        Compiler::_from_integral_unchecked(7));
+        TS_ASSERT(!result.ok);
+        TS_ASSERT_EQUALS(result.ptr, buffer);
+    }
+
+    void test_std_format()
+    {
+#ifdef __cpp_lib_format
+        TS_ASSERT(std::format("{}", +Compiler::Clang) == "Clang");
+        TS_ASSERT(std::format("{:>5}|{:<5}|", +Compiler::GCC,
+                              +Compiler::MSVC) == "  GCC|MSVC |");
+        TS_ASSERT(std::format("[{}]",
+                              Compiler::_from_integral_unchecked(7)) == "[]");
+#endif
+    }
 };
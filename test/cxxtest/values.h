@@ -0,0 +1,90 @@
+#include <cxxtest/TestSuite.h>
+#include <cstring>
+#include <enum.h>
+
+
+
+namespace values_only {
+
+BETTER_ENUM_VALUES_ONLY(Opcode, unsigned char, Nop, Load = 4, Store, Halt = 9)
+
+}
+
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+
+static_assert(values_only::Opcode::_size() == 4, "values-only constexpr");
+static_assert(values_only::Opcode::_from_integral(5) ==
+              +values_only::Opcode::Store, "values-only constexpr");
+static_assert(!values_only::Opcode::_is_valid(3), "values-only constexpr");
+static_assert(values_only::Opcode::_values()[3] == +values_only::Opcode::Halt,
+              "values-only constexpr");
+
+#endif
+
+
+
+class ValuesOnlyTests : public CxxTest::TestSuite {
+  public:
+    void test_conversions()
+    {
+        values_only::Opcode op = values_only::Opcode::Load;
+
+        TS_ASSERT_EQUALS(op._to_integral(), 4);
+        TS_ASSERT_EQUALS(op._to_index(), 1u);
+        TS_ASSERT_EQUALS(values_only::Opcode::_from_integral(9),
+                         +values_only::Opcode::Halt);
+        TS_ASSERT_EQUALS(values_only::Opcode::_from_index(2),
+                         +values_only::Opcode::Store);
+        TS_ASSERT(!values_only::Opcode::_from_integral_nothrow(6));
+        TS_ASSERT(values_only::Opcode::_is_valid(0));
+        TS_ASSERT(!values_only::Opcode::_is_valid(10));
+        TS_ASSERT_EQUALS(strcmp(values_only::Opcode::_name(), "Opcode"), 0);
+    }
+
+    void test_iteration()
+    {
+        unsigned char   expected[] = { 0, 4, 5, 9 };
+        size_t          position = 0;
+
+        for (values_only::Opcode::_value_iterator iterator =
+                 values_only::Opcode::_values().begin();
+             iterator != values_only::Opcode::_values().end(); ++iterator) {
+
+            TS_ASSERT_EQUALS(iterator->_to_integral(), expected[position]);
+            ++position;
+        }
+
+        TS_ASSERT_EQUALS(position, 4u);
+    }
+
+    void test_switch()
+    {
+#ifndef BETTER_ENUMS_STRICT_CONVERSION
+        values_only::Opcode op = values_only::Opcode::Store;
+        int                 visited = 0;
+
+        switch (op) {
+            case values_only::Opcode::Nop: break;
+            case values_only::Opcode::Load: break;
+            case values_only::Opcode::Store: visited = 1; break;
+            case values_only::Opcode::Halt: break;
+        }
+
+        TS_ASSERT_EQUALS(visited, 1);
+#endif
+    }
+
+    void test_bulk()
+    {
+        unsigned char           integrals[] = { 4, 9, 7 };
+        values_only::Opcode     converted[] =
+            { values_only::Opcode::Nop, values_only::Opcode::Nop,
+              values_only::Opcode::Nop };
+
+        TS_ASSERT_EQUALS(
+            better_enums::from_integral_n(integrals, 3, converted), 2u);
+        TS_ASSERT_EQUALS(converted[1], +values_only::Opcode::Halt);
+        TS_ASSERT_EQUALS(
+            better_enums::validate_n<values_only::Opcode>(integrals, 2), 2u);
+    }
+};
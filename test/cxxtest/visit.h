@@ -0,0 +1,114 @@
+#include <cxxtest/TestSuite.h>
+#include <string>
+#include <enum.h>
+
+
+
+namespace visiting {
+
+BETTER_ENUM(Shape, int, Circle, Square = 4, Triangle = 3, Box = Square)
+
+template <typename Enum>
+struct index_of {
+    template <typename Constant>
+    size_t operator ()(Constant) const { return Constant::index; }
+};
+
+struct name_of {
+    template <typename Constant>
+    std::string operator ()(Constant constant) const
+    {
+        return static_cast<Shape>(constant)._to_string();
+    }
+};
+
+struct counter {
+    explicit counter(int *calls) : _calls(calls) { }
+
+    template <typename Constant>
+    void operator ()(Constant) const { ++*_calls; }
+
+  private:
+    int     *_calls;
+};
+
+template <size_t Index>
+struct sides;
+
+template <> struct sides<0> { static const int count = 0; };
+template <> struct sides<1> { static const int count = 4; };
+template <> struct sides<2> { static const int count = 3; };
+template <> struct sides<3> { static const int count = 4; };
+
+struct sides_of {
+    template <typename Constant>
+    int operator ()(Constant) const
+    {
+        return sides<Constant::index>::count;
+    }
+};
+
+}
+
+
+
+class VisitTests : public CxxTest::TestSuite {
+  public:
+    void test_index()
+    {
+        for (size_t index = 0; index < visiting::Shape::_size(); ++index) {
+            TS_ASSERT_EQUALS(
+                better_enums::visit<size_t>(
+                    visiting::Shape::_values()[index],
+                    visiting::index_of<visiting::Shape>()),
+                visiting::Shape::_values()[index]._to_index());
+        }
+    }
+
+    void test_value()
+    {
+        TS_ASSERT_EQUALS(
+            better_enums::visit<std::string>(+visiting::Shape::Triangle,
+                                             visiting::name_of()),
+            "Triangle");
+        TS_ASSERT_EQUALS(
+            better_enums::visit<std::string>(+visiting::Shape::Box,
+                                             visiting::name_of()),
+            "Square");
+    }
+
+    void test_compile_time_index()
+    {
+        TS_ASSERT_EQUALS(
+            better_enums::visit<int>(+visiting::Shape::Triangle,
+                                     visiting::sides_of()),
+            3);
+        TS_ASSERT_EQUALS(
+            better_enums::visit<int>(+visiting::Shape::Circle,
+                                     visiting::sides_of()),
+            0);
+    }
+
+    void test_void_result()
+    {
+        int     calls = 0;
+
+        better_enums::visit<void>(+visiting::Shape::Square,
+                                  visiting::counter(&calls));
+        TS_ASSERT_EQUALS(calls, 1);
+    }
+
+    void test_deduced_result()
+    {
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+        TS_ASSERT_EQUALS(
+            better_enums::visit(+visiting::Shape::Square,
+                                visiting::sides_of()),
+            4);
+        TS_ASSERT_EQUALS(
+            better_enums::visit(+visiting::Shape::Circle,
+                                visiting::name_of()),
+            "Circle");
+#endif
+    }
+};
@@ -0,0 +1,89 @@
+#include <cxxtest/TestSuite.h>
+#include <cwchar>
+#include <stdexcept>
+#include <enum.h>
+
+
+
+namespace wide {
+
+BETTER_ENUM(Provider, int, Kernel = 1, Network, Storage = 10, Disk = Storage)
+
+}
+
+#ifdef BETTER_ENUMS_HAVE_RELAXED_CONSTEXPR
+
+static_assert(better_enums::to_basic_string<char16_t>(+wide::Provider::Disk)[0]
+                  == u'S', "constexpr wide names");
+static_assert(*better_enums::from_basic_string_nothrow<wide::Provider>(
+                  U"Network") == +wide::Provider::Network,
+              "constexpr wide names");
+
+#endif
+
+
+
+class WideNameTests : public CxxTest::TestSuite {
+  public:
+    void test_to_basic_string()
+    {
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+        const wchar_t   *name =
+            better_enums::to_basic_string<wchar_t>(+wide::Provider::Network);
+
+        TS_ASSERT_EQUALS(wcscmp(name, L"Network"), 0);
+        TS_ASSERT_EQUALS(
+            better_enums::to_basic_string<wchar_t>(+wide::Provider::Network),
+            name);
+        TS_ASSERT_EQUALS(
+            wcscmp(better_enums::to_basic_string<wchar_t>(
+                       +wide::Provider::Disk), L"Storage"), 0);
+        TS_ASSERT(better_enums::to_basic_string<wchar_t>(
+                      wide::Provider::_from_integral_unchecked(3)) == NULL);
+
+        const char32_t  *utf32 =
+            better_enums::to_basic_string<char32_t>(+wide::Provider::Kernel);
+
+        TS_ASSERT_EQUALS(utf32[0], U'K');
+        TS_ASSERT_EQUALS(utf32[6], U'\0');
+#endif
+    }
+
+    void test_from_basic_string()
+    {
+#ifdef BETTER_ENUMS_HAVE_CONSTEXPR
+        TS_ASSERT_EQUALS(
+            *better_enums::from_basic_string_nothrow<wide::Provider>(L"Disk"),
+            +wide::Provider::Storage);
+        TS_ASSERT_EQUALS(
+            *better_enums::from_basic_string_nothrow<wide::Provider>(
+                L"Kernel32", 6), +wide::Provider::Kernel);
+        TS_ASSERT(!better_enums::from_basic_string_nothrow<wide::Provider>(
+                       L"Kernel32"));
+        TS_ASSERT(!better_enums::from_basic_string_nothrow<wide::Provider>(
+                       L"Dis\x0100"));
+        TS_ASSERT(!better_enums::from_basic_string_nothrow<wide::Provider>(
+                       L"Dis\x0100", 4));
+        TS_ASSERT(!better_enums::from_basic_string_nothrow<wide::Provider>(
+                       L"AVeryLongNameIndeed"));
+        TS_ASSERT_THROWS(
+            better_enums::from_basic_string<wide::Provider>(L"disk"),
+            std::runtime_error);
+#endif
+    }
+
+    void test_members()
+    {
+#ifdef BETTER_ENUMS_WIDE_NAMES
+        TS_ASSERT_EQUALS(wcscmp((+wide::Provider::Storage)._to_wstring(),
+                                L"Storage"), 0);
+        TS_ASSERT_EQUALS(wide::Provider::_from_wstring(L"Network"),
+                         +wide::Provider::Network);
+        TS_ASSERT_EQUALS(*wide::Provider::_from_wstring_nothrow(L"Disks", 4),
+                         +wide::Provider::Storage);
+        TS_ASSERT(!wide::Provider::_from_wstring_nothrow(L"Disks"));
+        TS_ASSERT_THROWS(wide::Provider::_from_wstring(L"Tape"),
+                         std::runtime_error);
+#endif
+    }
+};
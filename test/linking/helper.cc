@@ -6,3 +6,9 @@ void print(Channel channel)
     std::cout << Channel::_name() << "::" << channel._to_string() << std::endl;
     std::cout << Channel::_size() << std::endl;
 }
+
+void print(Depth depth)
+{
+    std::cout << Depth::_name() << "::" << depth << std::endl;
+    std::cout << Depth::_from_string("Abyss")._to_integral() << std::endl;
+}
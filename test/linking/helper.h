@@ -4,5 +4,6 @@
 #include "shared.h"
 
 void print(Channel channel);
+void print(Depth depth);
 
 #endif // #ifndef HELPER_H
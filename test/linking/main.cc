@@ -4,6 +4,7 @@
 int main()
 {
     print(Channel::Red);
+    print(Depth::_from_integral(5));
 
     return 0;
 }
@@ -0,0 +1,3 @@
+#include "shared.h"
+
+BETTER_ENUM_DEFINE(Depth, short, DEPTH_CONSTANTS)
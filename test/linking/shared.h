@@ -5,4 +5,7 @@
 
 BETTER_ENUM(Channel, int, Red, Green, Blue)
 
+#define DEPTH_CONSTANTS Shallow, Deep = 5, Abyss
+BETTER_ENUM_DECLARE(Depth, short, DEPTH_CONSTANTS)
+
 #endif // #ifndef SHARED_H
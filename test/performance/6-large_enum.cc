@@ -0,0 +1,92 @@
+#define BETTER_ENUMS_MACRO_FILE <test/performance/large_enum_macros.h>
+#include <enum.h>
+
+BETTER_ENUM(Symbol, int,
+            Symbol0, Symbol1, Symbol2, Symbol3, Symbol4, Symbol5, Symbol6,
+            Symbol7, Symbol8, Symbol9, Symbol10, Symbol11, Symbol12, Symbol13,
+            Symbol14, Symbol15, Symbol16, Symbol17, Symbol18, Symbol19,
+            Symbol20, Symbol21, Symbol22, Symbol23, Symbol24, Symbol25,
+            Symbol26, Symbol27, Symbol28, Symbol29, Symbol30, Symbol31,
+            Symbol32, Symbol33, Symbol34, Symbol35, Symbol36, Symbol37,
+            Symbol38, Symbol39, Symbol40, Symbol41, Symbol42, Symbol43,
+            Symbol44, Symbol45, Symbol46, Symbol47, Symbol48, Symbol49,
+            Symbol50, Symbol51, Symbol52, Symbol53, Symbol54, Symbol55,
+            Symbol56, Symbol57, Symbol58, Symbol59, Symbol60, Symbol61,
+            Symbol62, Symbol63, Symbol64, Symbol65, Symbol66, Symbol67,
+            Symbol68, Symbol69, Symbol70, Symbol71, Symbol72, Symbol73,
+            Symbol74, Symbol75, Symbol76, Symbol77, Symbol78, Symbol79,
+            Symbol80, Symbol81, Symbol82, Symbol83, Symbol84, Symbol85,
+            Symbol86, Symbol87, Symbol88, Symbol89, Symbol90, Symbol91,
+            Symbol92, Symbol93, Symbol94, Symbol95, Symbol96, Symbol97,
+            Symbol98, Symbol99, Symbol100, Symbol101, Symbol102, Symbol103,
+            Symbol104, Symbol105, Symbol106, Symbol107, Symbol108, Symbol109,
+            Symbol110, Symbol111, Symbol112, Symbol113, Symbol114, Symbol115,
+            Symbol116, Symbol117, Symbol118, Symbol119, Symbol120, Symbol121,
+            Symbol122, Symbol123, Symbol124, Symbol125, Symbol126, Symbol127,
+            Symbol128, Symbol129, Symbol130, Symbol131, Symbol132, Symbol133,
+            Symbol134, Symbol135, Symbol136, Symbol137, Symbol138, Symbol139,
+            Symbol140, Symbol141, Symbol142, Symbol143, Symbol144, Symbol145,
+            Symbol146, Symbol147, Symbol148, Symbol149, Symbol150, Symbol151,
+            Symbol152, Symbol153, Symbol154, Symbol155, Symbol156, Symbol157,
+            Symbol158, Symbol159, Symbol160, Symbol161, Symbol162, Symbol163,
+            Symbol164, Symbol165, Symbol166, Symbol167, Symbol168, Symbol169,
+            Symbol170, Symbol171, Symbol172, Symbol173, Symbol174, Symbol175,
+            Symbol176, Symbol177, Symbol178, Symbol179, Symbol180, Symbol181,
+            Symbol182, Symbol183, Symbol184, Symbol185, Symbol186, Symbol187,
+            Symbol188, Symbol189, Symbol190, Symbol191, Symbol192, Symbol193,
+            Symbol194, Symbol195, Symbol196, Symbol197, Symbol198, Symbol199,
+            Symbol200, Symbol201, Symbol202, Symbol203, Symbol204, Symbol205,
+            Symbol206, Symbol207, Symbol208, Symbol209, Symbol210, Symbol211,
+            Symbol212, Symbol213, Symbol214, Symbol215, Symbol216, Symbol217,
+            Symbol218, Symbol219, Symbol220, Symbol221, Symbol222, Symbol223,
+            Symbol224, Symbol225, Symbol226, Symbol227, Symbol228, Symbol229,
+            Symbol230, Symbol231, Symbol232, Symbol233, Symbol234, Symbol235,
+            Symbol236, Symbol237, Symbol238, Symbol239, Symbol240, Symbol241,
+            Symbol242, Symbol243, Symbol244, Symbol245, Symbol246, Symbol247,
+            Symbol248, Symbol249, Symbol250, Symbol251, Symbol252, Symbol253,
+            Symbol254, Symbol255, Symbol256, Symbol257, Symbol258, Symbol259,
+            Symbol260, Symbol261, Symbol262, Symbol263, Symbol264, Symbol265,
+            Symbol266, Symbol267, Symbol268, Symbol269, Symbol270, Symbol271,
+            Symbol272, Symbol273, Symbol274, Symbol275, Symbol276, Symbol277,
+            Symbol278, Symbol279, Symbol280, Symbol281, Symbol282, Symbol283,
+            Symbol284, Symbol285, Symbol286, Symbol287, Symbol288, Symbol289,
+            Symbol290, Symbol291, Symbol292, Symbol293, Symbol294, Symbol295,
+            Symbol296, Symbol297, Symbol298, Symbol299, Symbol300, Symbol301,
+            Symbol302, Symbol303, Symbol304, Symbol305, Symbol306, Symbol307,
+            Symbol308, Symbol309, Symbol310, Symbol311, Symbol312, Symbol313,
+            Symbol314, Symbol315, Symbol316, Symbol317, Symbol318, Symbol319,
+            Symbol320, Symbol321, Symbol322, Symbol323, Symbol324, Symbol325,
+            Symbol326, Symbol327, Symbol328, Symbol329, Symbol330, Symbol331,
+            Symbol332, Symbol333, Symbol334, Symbol335, Symbol336, Symbol337,
+            Symbol338, Symbol339, Symbol340, Symbol341, Symbol342, Symbol343,
+            Symbol344, Symbol345, Symbol346, Symbol347, Symbol348, Symbol349,
+            Symbol350, Symbol351, Symbol352, Symbol353, Symbol354, Symbol355,
+            Symbol356, Symbol357, Symbol358, Symbol359, Symbol360, Symbol361,
+            Symbol362, Symbol363, Symbol364, Symbol365, Symbol366, Symbol367,
+            Symbol368, Symbol369, Symbol370, Symbol371, Symbol372, Symbol373,
+            Symbol374, Symbol375, Symbol376, Symbol377, Symbol378, Symbol379,
+            Symbol380, Symbol381, Symbol382, Symbol383, Symbol384, Symbol385,
+            Symbol386, Symbol387, Symbol388, Symbol389, Symbol390, Symbol391,
+            Symbol392, Symbol393, Symbol394, Symbol395, Symbol396, Symbol397,
+            Symbol398, Symbol399, Symbol400, Symbol401, Symbol402, Symbol403,
+            Symbol404, Symbol405, Symbol406, Symbol407, Symbol408, Symbol409,
+            Symbol410, Symbol411, Symbol412, Symbol413, Symbol414, Symbol415,
+            Symbol416, Symbol417, Symbol418, Symbol419, Symbol420, Symbol421,
+            Symbol422, Symbol423, Symbol424, Symbol425, Symbol426, Symbol427,
+            Symbol428, Symbol429, Symbol430, Symbol431, Symbol432, Symbol433,
+            Symbol434, Symbol435, Symbol436, Symbol437, Symbol438, Symbol439,
+            Symbol440, Symbol441, Symbol442, Symbol443, Symbol444, Symbol445,
+            Symbol446, Symbol447, Symbol448, Symbol449, Symbol450, Symbol451,
+            Symbol452, Symbol453, Symbol454, Symbol455, Symbol456, Symbol457,
+            Symbol458, Symbol459, Symbol460, Symbol461, Symbol462, Symbol463,
+            Symbol464, Symbol465, Symbol466, Symbol467, Symbol468, Symbol469,
+            Symbol470, Symbol471, Symbol472, Symbol473, Symbol474, Symbol475,
+            Symbol476, Symbol477, Symbol478, Symbol479, Symbol480, Symbol481,
+            Symbol482, Symbol483, Symbol484, Symbol485, Symbol486, Symbol487,
+            Symbol488, Symbol489, Symbol490, Symbol491, Symbol492, Symbol493,
+            Symbol494, Symbol495, Symbol496, Symbol497, Symbol498, Symbol499)
+
+int main()
+{
+    return 0;
+}
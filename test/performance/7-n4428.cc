@@ -0,0 +1,74 @@
+#include <enum.h>
+#include <better-enums/n4428.h>
+
+
+BETTER_ENUM(Channel, int,
+            Red, Green, Blue, Cyan, Magenta, Yellow, Black, Hue, Saturation,
+            Value)
+
+BETTER_ENUM(Direction, int,
+            North, East, South, West, NorthEast, SouthEast, SouthWest,
+            NorthWest, NorthNorthEast, EastNorthEast, EastSouthEast,
+            SouthSouthEast, SouthSouthWest, WestSouthWest, WestNorthWest,
+            NorthNorthWest)
+
+BETTER_ENUM(ASTNode, int,
+            IntegerLiteral, StringLiteral, CharacterLiteral, Variable,
+            UnaryOperation, BinaryOperation, ApplicationExpression, Abstraction,
+            LetBinding, CaseExpression, Pattern, Signature, Module, Functor,
+            TypeVariable, BasicType, ArrowType, VariantTypeConstant)
+
+BETTER_ENUM(State, int,
+            Attacking, Defending, Searching, Pursuing, Hungry, Fleeing,
+            Confused, Healing, Stunned)
+
+BETTER_ENUM(APIMethod, int,
+            ReadPost, WritePost, PollPost, ReadImage, WriteImage, PollImage,
+            ReadKey, WriteKey, PollKey, ReadUser, WriteUser, PollUser,
+            ReadOrganization, WriteOrganization, PollOrganization, ReadGroup,
+            WriteGroup, PollGroup, ReadProject, WriteProject, PollProject,
+            ReadComment, WriteComment, PollComment, ReadPermission,
+            WritePermission, PollPermission, ReadOwner, WriteOwner, PollOwner,
+            ReadProposal, WriteProposal, PollProposal, ReadHistory,
+            WriteHistory, PollHistory)
+
+BETTER_ENUM(Lipsum, int,
+            Lorem, ipsum, dolor, sit, amet, consectetur, adipiscing, elit,
+            Vivamus, libero, massa, tincidunt, at, ex, nec, porta, malesuada,
+            arcu, Nullam, lectus, nibh, dictum, eget, convallis, ac, feugiat,
+            felis, Suspendisse, quis, purus, vel, lacus, cursus, tristique,
+            Donec, augue, tortor, luctus, a, sed, mattis, in, quam, Cras, vitae,
+            euismod, Cum, sociis, natoque, penatibus, et, magnis, dis,
+            parturient)
+
+// Walks all the enumerators of each enum through the N4428 traits interface,
+// instantiating get_alt once per constant.
+template <typename Enum, std::size_t Index = 0,
+          bool Done = Index == std::enum_traits<Enum>::enumerators::size>
+struct sum_values {
+    constexpr static int    value =
+        std::enum_traits<Enum>::enumerators::template get_alt<Index>::value
+            ._to_integral() +
+        sum_values<Enum, Index + 1>::value;
+};
+
+template <typename Enum, std::size_t Index>
+struct sum_values<Enum, Index, true> {
+    constexpr static int    value = 0;
+};
+
+static_assert(sum_values<Channel>::value == 45, "");
+static_assert(sum_values<Direction>::value == 120, "");
+static_assert(sum_values<ASTNode>::value == 153, "");
+static_assert(sum_values<State>::value == 36, "");
+static_assert(sum_values<APIMethod>::value == 630, "");
+static_assert(sum_values<Lipsum>::value == 1431, "");
+
+static_assert(std::enum_traits<Lipsum>::is_contiguous, "");
+static_assert(std::enum_traits<APIMethod>::max_value == +APIMethod::PollHistory,
+              "");
+
+int main()
+{
+    return 0;
+}
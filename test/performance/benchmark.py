@@ -0,0 +1,238 @@
+#! /usr/bin/env python
+
+# Compile-time benchmark for Better Enums.
+#
+# Compiles each of the files in this directory, and a few generated files,
+# several times with the given compiler, and prints the median and minimum
+# compilation time of each as JSON or CSV. The results include the time taken to
+# compile each file relative to the time taken to compile a file that only
+# includes iostream, as described in doc/Performance.md, so that results from
+# different machines can be compared.
+#
+# Usage:
+#
+#     python benchmark.py [--compiler CXX] [--std STANDARD] [--repeat N]
+#                         [--format json|csv] [--output FILE]
+#
+# For example, to save timings for g++ in C++11 mode,
+#
+#     python benchmark.py --compiler g++ --std c++11 > g++-c++11.json
+#
+# Only compilers with a g++-compatible command line are supported, such as g++
+# and clang++. Cases that need a later standard than STANDARD are skipped. If
+# STANDARD is not given, the compiler's default standard is used and all cases
+# are attempted. Cases that fail to compile are reported with "failed" set.
+
+from __future__ import print_function
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+
+
+DIRECTORY = os.path.dirname(os.path.abspath(__file__))
+ROOT = os.path.normpath(os.path.join(DIRECTORY, '..', '..'))
+
+STANDARDS = ['c++98', 'c++11', 'c++14', 'c++17']
+
+# Constant counts of the generated enums used to measure scaling. Counts above
+# 64 use the extended macros in large_enum_macros.h, so all counts use them.
+SCALING_COUNTS = [8, 32, 128, 500]
+
+# Each case is (name, source file, extra compiler flags, minimum standard).
+# SLOW_ENUM is the same as BETTER_ENUM with BETTER_ENUMS_CONSTEXPR_TO_STRING
+# defined, so the slow_enum case compiles 4-declare_enums.cc with that flag.
+CASES = [
+    ('simple', '1-simple.cc', [], 'c++98'),
+    ('include_empty', '2-include_empty.cc', [], 'c++98'),
+    ('include_enum', '3-only_include_enum.cc', [], 'c++98'),
+    ('iostream', '5-iostream.cc', [], 'c++98'),
+    ('declare_enums', '4-declare_enums.cc', [], 'c++98'),
+    ('slow_enum', '4-declare_enums.cc',
+     ['-DBETTER_ENUMS_CONSTEXPR_TO_STRING'], 'c++11'),
+    ('constexpr_names', '4-declare_enums.cc',
+     ['-DBETTER_ENUMS_CONSTEXPR_NAMES'], 'c++14'),
+    ('strict_conversion', '4-declare_enums.cc',
+     ['-DBETTER_ENUMS_STRICT_CONVERSION'], 'c++11'),
+    ('n4428', '7-n4428.cc', [], 'c++11'),
+    ('large_enum', '6-large_enum.cc', [], 'c++98'),
+]
+
+
+
+def supports(standard, minimum):
+    if standard is None:
+        return True
+    if standard not in STANDARDS:
+        return True
+    return STANDARDS.index(standard) >= STANDARDS.index(minimum)
+
+def count_enums(path):
+    with open(path) as source:
+        return len(re.findall(r'^BETTER_ENUM\(', source.read(), re.MULTILINE))
+
+def write_scaling_case(directory, count):
+    path = os.path.join(directory, 'scaling_' + str(count) + '.cc')
+    with open(path, 'w') as stream:
+        print('#define BETTER_ENUMS_MACRO_FILE '
+              '<test/performance/large_enum_macros.h>', file=stream)
+        print('#include <enum.h>', file=stream)
+        print('', file=stream)
+        print('BETTER_ENUM(Scaling, int,', file=stream)
+        names = ['Constant' + str(index) for index in range(count)]
+        for start in range(0, count, 6):
+            line = ', '.join(names[start:start + 6])
+            if start + 6 < count:
+                print('            ' + line + ',', file=stream)
+            else:
+                print('            ' + line + ')', file=stream)
+        print('', file=stream)
+        print('int main()', file=stream)
+        print('{', file=stream)
+        print('    return 0;', file=stream)
+        print('}', file=stream)
+    return path
+
+def compiler_version(compiler):
+    try:
+        output = subprocess.check_output([compiler, '--version'],
+                                         stderr = subprocess.STDOUT)
+        return output.decode('utf-8', 'replace').splitlines()[0].strip()
+    except (OSError, subprocess.CalledProcessError, IndexError):
+        return 'unknown'
+
+def time_compilation(command, repeat):
+    timings = []
+    with open(os.devnull, 'w') as null:
+        for _ in range(repeat):
+            start = time.time()
+            status = subprocess.call(command, stdout = null, stderr = null)
+            elapsed = time.time() - start
+            if status != 0:
+                return None
+            timings.append(elapsed)
+    return sorted(timings)
+
+def median(values):
+    middle = len(values) // 2
+    if len(values) % 2 == 1:
+        return values[middle]
+    return (values[middle - 1] + values[middle]) / 2.0
+
+def run(arguments):
+    scratch = tempfile.mkdtemp(prefix = 'better-enums-benchmark-')
+    try:
+        cases = [(name, os.path.join(DIRECTORY, source), flags, minimum)
+                 for name, source, flags, minimum in CASES]
+        for count in SCALING_COUNTS:
+            cases.append(('scaling_' + str(count),
+                          write_scaling_case(scratch, count), [], 'c++98'))
+
+        base = [arguments.compiler, '-I' + ROOT,
+                '-I' + os.path.join(ROOT, 'extra'), '-c',
+                '-o', os.path.join(scratch, 'out.o')]
+        if arguments.std is not None:
+            base.append('-std=' + arguments.std)
+
+        results = []
+        for name, path, flags, minimum in cases:
+            if not supports(arguments.std, minimum):
+                continue
+
+            timings = time_compilation(base + flags + [path], arguments.repeat)
+            result = {'name': name,
+                      'file': os.path.relpath(path, ROOT)
+                              if path.startswith(DIRECTORY) else None,
+                      'flags': flags,
+                      'enums': count_enums(path)}
+            if timings is None:
+                result['failed'] = True
+            else:
+                result['failed'] = False
+                result['median'] = median(timings)
+                result['minimum'] = timings[0]
+            if name.startswith('scaling_'):
+                result['constants'] = int(name[len('scaling_'):])
+            results.append(result)
+    finally:
+        shutil.rmtree(scratch)
+
+    by_name = dict((result['name'], result) for result in results
+                   if not result['failed'])
+
+    if 'iostream' in by_name:
+        for result in results:
+            if not result['failed']:
+                result['ratio_to_iostream'] = \
+                    result['median'] / by_name['iostream']['median']
+
+    derived = {}
+    if 'include_enum' in by_name and 'simple' in by_name:
+        derived['include_cost'] = \
+            by_name['include_enum']['median'] - by_name['simple']['median']
+    if 'declare_enums' in by_name and 'include_enum' in by_name:
+        declare = by_name['declare_enums']
+        derived['per_enum_cost'] = \
+            (declare['median'] - by_name['include_enum']['median']) / \
+            declare['enums']
+        for variant in ['slow_enum', 'constexpr_names', 'strict_conversion']:
+            if variant in by_name:
+                derived[variant + '_per_enum_cost'] = \
+                    (by_name[variant]['median'] -
+                     by_name['include_enum']['median']) / declare['enums']
+
+    return {'compiler': arguments.compiler,
+            'version': compiler_version(arguments.compiler),
+            'standard': arguments.std,
+            'repeat': arguments.repeat,
+            'results': results,
+            'derived': derived}
+
+def print_json(report, stream):
+    json.dump(report, stream, indent = 2, sort_keys = True)
+    print('', file=stream)
+
+def print_csv(report, stream):
+    print('compiler,standard,case,median,minimum,ratio_to_iostream',
+          file=stream)
+    for result in report['results']:
+        if result['failed']:
+            fields = ['', '', '']
+        else:
+            fields = ['%.4f' % result['median'], '%.4f' % result['minimum'],
+                      '%.3f' % result.get('ratio_to_iostream', 0)]
+        print(','.join([report['compiler'], report['standard'] or '',
+                        result['name']] + fields), file=stream)
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        description = 'Measures compilation time of Better Enums.')
+    parser.add_argument('--compiler', default = os.environ.get('CXX', 'c++'))
+    parser.add_argument('--std', default = None)
+    parser.add_argument('--repeat', type = int, default = 5)
+    parser.add_argument('--format', choices = ['json', 'csv'],
+                        default = 'json')
+    parser.add_argument('--output', default = None)
+    arguments = parser.parse_args()
+
+    report = run(arguments)
+
+    if arguments.output is None:
+        stream = sys.stdout
+    else:
+        stream = open(arguments.output, 'w')
+
+    if arguments.format == 'json':
+        print_json(report, stream)
+    else:
+        print_csv(report, stream)
+
+    if arguments.output is not None:
+        stream.close()
@@ -0,0 +1,1634 @@
+// This file was automatically generated by make_macros.py
+
+#pragma once
+
+#ifndef BETTER_ENUMS_MACRO_FILE_H
+#define BETTER_ENUMS_MACRO_FILE_H
+
+#define BETTER_ENUMS_PP_MAP(macro, data, ...) \
+    BETTER_ENUMS_ID( \
+        BETTER_ENUMS_APPLY( \
+            BETTER_ENUMS_PP_MAP_VAR_COUNT, \
+            BETTER_ENUMS_PP_COUNT(__VA_ARGS__)) \
+        (macro, data, __VA_ARGS__))
+
+#define BETTER_ENUMS_PP_MAP_VAR_COUNT(count) BETTER_ENUMS_M ## count
+
+#define BETTER_ENUMS_APPLY(macro, ...) BETTER_ENUMS_ID(macro(__VA_ARGS__))
+
+#define BETTER_ENUMS_ID(x) x
+
+#define BETTER_ENUMS_M1(m,d,x0) m(d,0,x0)
+#define BETTER_ENUMS_M2(m,d,x0,x1) m(d,1,x0) m(d,0,x1)
+#define BETTER_ENUMS_M3(m,d,x0,x1,x2) m(d,2,x0) m(d,1,x1) m(d,0,x2)
+#define BETTER_ENUMS_M4(m,d,x0,x1,x2,x3) m(d,3,x0) m(d,2,x1) m(d,1,x2) m(d,0,x3)
+#define BETTER_ENUMS_M5(m,d,x0,x1,x2,x3,x4) m(d,4,x0) m(d,3,x1) m(d,2,x2)      \
+    m(d,1,x3) m(d,0,x4)
+#define BETTER_ENUMS_M6(m,d,x0,x1,x2,x3,x4,x5) m(d,5,x0) m(d,4,x1) m(d,3,x2)   \
+    m(d,2,x3) m(d,1,x4) m(d,0,x5)
+#define BETTER_ENUMS_M7(m,d,x0,x1,x2,x3,x4,x5,x6) m(d,6,x0) m(d,5,x1) m(d,4,x2)\
+    m(d,3,x3) m(d,2,x4) m(d,1,x5) m(d,0,x6)
+#define BETTER_ENUMS_M8(m,d,x0,x1,x2,x3,x4,x5,x6,x7) m(d,7,x0) m(d,6,x1)       \
+    m(d,5,x2) m(d,4,x3) m(d,3,x4) m(d,2,x5) m(d,1,x6) m(d,0,x7)
+#define BETTER_ENUMS_M9(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,8,x0) m(d,7,x1)   \
+    m(d,6,x2) m(d,5,x3) m(d,4,x4) m(d,3,x5) m(d,2,x6) m(d,1,x7)                \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M1(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M10(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,9,x0) m(d,8,x1)  \
+    m(d,7,x2) m(d,6,x3) m(d,5,x4) m(d,4,x5) m(d,3,x6) m(d,2,x7)                \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M2(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M11(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,10,x0) m(d,9,x1) \
+    m(d,8,x2) m(d,7,x3) m(d,6,x4) m(d,5,x5) m(d,4,x6) m(d,3,x7)                \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M3(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M12(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,11,x0) m(d,10,x1)\
+    m(d,9,x2) m(d,8,x3) m(d,7,x4) m(d,6,x5) m(d,5,x6) m(d,4,x7)                \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M4(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M13(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,12,x0) m(d,11,x1)\
+    m(d,10,x2) m(d,9,x3) m(d,8,x4) m(d,7,x5) m(d,6,x6) m(d,5,x7)               \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M5(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M14(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,13,x0) m(d,12,x1)\
+    m(d,11,x2) m(d,10,x3) m(d,9,x4) m(d,8,x5) m(d,7,x6) m(d,6,x7)              \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M6(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M15(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,14,x0) m(d,13,x1)\
+    m(d,12,x2) m(d,11,x3) m(d,10,x4) m(d,9,x5) m(d,8,x6) m(d,7,x7)             \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M7(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M16(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,15,x0) m(d,14,x1)\
+    m(d,13,x2) m(d,12,x3) m(d,11,x4) m(d,10,x5) m(d,9,x6) m(d,8,x7)            \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M8(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M17(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,16,x0) m(d,15,x1)\
+    m(d,14,x2) m(d,13,x3) m(d,12,x4) m(d,11,x5) m(d,10,x6) m(d,9,x7)           \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M9(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M18(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,17,x0) m(d,16,x1)\
+    m(d,15,x2) m(d,14,x3) m(d,13,x4) m(d,12,x5) m(d,11,x6) m(d,10,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M10(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M19(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,18,x0) m(d,17,x1)\
+    m(d,16,x2) m(d,15,x3) m(d,14,x4) m(d,13,x5) m(d,12,x6) m(d,11,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M11(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M20(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,19,x0) m(d,18,x1)\
+    m(d,17,x2) m(d,16,x3) m(d,15,x4) m(d,14,x5) m(d,13,x6) m(d,12,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M12(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M21(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,20,x0) m(d,19,x1)\
+    m(d,18,x2) m(d,17,x3) m(d,16,x4) m(d,15,x5) m(d,14,x6) m(d,13,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M13(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M22(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,21,x0) m(d,20,x1)\
+    m(d,19,x2) m(d,18,x3) m(d,17,x4) m(d,16,x5) m(d,15,x6) m(d,14,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M14(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M23(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,22,x0) m(d,21,x1)\
+    m(d,20,x2) m(d,19,x3) m(d,18,x4) m(d,17,x5) m(d,16,x6) m(d,15,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M15(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M24(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,23,x0) m(d,22,x1)\
+    m(d,21,x2) m(d,20,x3) m(d,19,x4) m(d,18,x5) m(d,17,x6) m(d,16,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M16(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M25(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,24,x0) m(d,23,x1)\
+    m(d,22,x2) m(d,21,x3) m(d,20,x4) m(d,19,x5) m(d,18,x6) m(d,17,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M17(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M26(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,25,x0) m(d,24,x1)\
+    m(d,23,x2) m(d,22,x3) m(d,21,x4) m(d,20,x5) m(d,19,x6) m(d,18,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M18(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M27(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,26,x0) m(d,25,x1)\
+    m(d,24,x2) m(d,23,x3) m(d,22,x4) m(d,21,x5) m(d,20,x6) m(d,19,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M19(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M28(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,27,x0) m(d,26,x1)\
+    m(d,25,x2) m(d,24,x3) m(d,23,x4) m(d,22,x5) m(d,21,x6) m(d,20,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M20(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M29(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,28,x0) m(d,27,x1)\
+    m(d,26,x2) m(d,25,x3) m(d,24,x4) m(d,23,x5) m(d,22,x6) m(d,21,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M21(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M30(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,29,x0) m(d,28,x1)\
+    m(d,27,x2) m(d,26,x3) m(d,25,x4) m(d,24,x5) m(d,23,x6) m(d,22,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M22(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M31(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,30,x0) m(d,29,x1)\
+    m(d,28,x2) m(d,27,x3) m(d,26,x4) m(d,25,x5) m(d,24,x6) m(d,23,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M23(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M32(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,31,x0) m(d,30,x1)\
+    m(d,29,x2) m(d,28,x3) m(d,27,x4) m(d,26,x5) m(d,25,x6) m(d,24,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M24(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M33(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,32,x0) m(d,31,x1)\
+    m(d,30,x2) m(d,29,x3) m(d,28,x4) m(d,27,x5) m(d,26,x6) m(d,25,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M25(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M34(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,33,x0) m(d,32,x1)\
+    m(d,31,x2) m(d,30,x3) m(d,29,x4) m(d,28,x5) m(d,27,x6) m(d,26,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M26(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M35(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,34,x0) m(d,33,x1)\
+    m(d,32,x2) m(d,31,x3) m(d,30,x4) m(d,29,x5) m(d,28,x6) m(d,27,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M27(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M36(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,35,x0) m(d,34,x1)\
+    m(d,33,x2) m(d,32,x3) m(d,31,x4) m(d,30,x5) m(d,29,x6) m(d,28,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M28(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M37(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,36,x0) m(d,35,x1)\
+    m(d,34,x2) m(d,33,x3) m(d,32,x4) m(d,31,x5) m(d,30,x6) m(d,29,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M29(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M38(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,37,x0) m(d,36,x1)\
+    m(d,35,x2) m(d,34,x3) m(d,33,x4) m(d,32,x5) m(d,31,x6) m(d,30,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M30(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M39(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,38,x0) m(d,37,x1)\
+    m(d,36,x2) m(d,35,x3) m(d,34,x4) m(d,33,x5) m(d,32,x6) m(d,31,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M31(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M40(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,39,x0) m(d,38,x1)\
+    m(d,37,x2) m(d,36,x3) m(d,35,x4) m(d,34,x5) m(d,33,x6) m(d,32,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M32(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M41(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,40,x0) m(d,39,x1)\
+    m(d,38,x2) m(d,37,x3) m(d,36,x4) m(d,35,x5) m(d,34,x6) m(d,33,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M33(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M42(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,41,x0) m(d,40,x1)\
+    m(d,39,x2) m(d,38,x3) m(d,37,x4) m(d,36,x5) m(d,35,x6) m(d,34,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M34(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M43(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,42,x0) m(d,41,x1)\
+    m(d,40,x2) m(d,39,x3) m(d,38,x4) m(d,37,x5) m(d,36,x6) m(d,35,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M35(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M44(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,43,x0) m(d,42,x1)\
+    m(d,41,x2) m(d,40,x3) m(d,39,x4) m(d,38,x5) m(d,37,x6) m(d,36,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M36(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M45(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,44,x0) m(d,43,x1)\
+    m(d,42,x2) m(d,41,x3) m(d,40,x4) m(d,39,x5) m(d,38,x6) m(d,37,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M37(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M46(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,45,x0) m(d,44,x1)\
+    m(d,43,x2) m(d,42,x3) m(d,41,x4) m(d,40,x5) m(d,39,x6) m(d,38,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M38(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M47(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,46,x0) m(d,45,x1)\
+    m(d,44,x2) m(d,43,x3) m(d,42,x4) m(d,41,x5) m(d,40,x6) m(d,39,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M39(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M48(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,47,x0) m(d,46,x1)\
+    m(d,45,x2) m(d,44,x3) m(d,43,x4) m(d,42,x5) m(d,41,x6) m(d,40,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M40(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M49(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,48,x0) m(d,47,x1)\
+    m(d,46,x2) m(d,45,x3) m(d,44,x4) m(d,43,x5) m(d,42,x6) m(d,41,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M41(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M50(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,49,x0) m(d,48,x1)\
+    m(d,47,x2) m(d,46,x3) m(d,45,x4) m(d,44,x5) m(d,43,x6) m(d,42,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M42(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M51(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,50,x0) m(d,49,x1)\
+    m(d,48,x2) m(d,47,x3) m(d,46,x4) m(d,45,x5) m(d,44,x6) m(d,43,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M43(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M52(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,51,x0) m(d,50,x1)\
+    m(d,49,x2) m(d,48,x3) m(d,47,x4) m(d,46,x5) m(d,45,x6) m(d,44,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M44(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M53(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,52,x0) m(d,51,x1)\
+    m(d,50,x2) m(d,49,x3) m(d,48,x4) m(d,47,x5) m(d,46,x6) m(d,45,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M45(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M54(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,53,x0) m(d,52,x1)\
+    m(d,51,x2) m(d,50,x3) m(d,49,x4) m(d,48,x5) m(d,47,x6) m(d,46,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M46(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M55(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,54,x0) m(d,53,x1)\
+    m(d,52,x2) m(d,51,x3) m(d,50,x4) m(d,49,x5) m(d,48,x6) m(d,47,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M47(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M56(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,55,x0) m(d,54,x1)\
+    m(d,53,x2) m(d,52,x3) m(d,51,x4) m(d,50,x5) m(d,49,x6) m(d,48,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M48(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M57(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,56,x0) m(d,55,x1)\
+    m(d,54,x2) m(d,53,x3) m(d,52,x4) m(d,51,x5) m(d,50,x6) m(d,49,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M49(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M58(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,57,x0) m(d,56,x1)\
+    m(d,55,x2) m(d,54,x3) m(d,53,x4) m(d,52,x5) m(d,51,x6) m(d,50,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M50(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M59(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,58,x0) m(d,57,x1)\
+    m(d,56,x2) m(d,55,x3) m(d,54,x4) m(d,53,x5) m(d,52,x6) m(d,51,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M51(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M60(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,59,x0) m(d,58,x1)\
+    m(d,57,x2) m(d,56,x3) m(d,55,x4) m(d,54,x5) m(d,53,x6) m(d,52,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M52(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M61(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,60,x0) m(d,59,x1)\
+    m(d,58,x2) m(d,57,x3) m(d,56,x4) m(d,55,x5) m(d,54,x6) m(d,53,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M53(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M62(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,61,x0) m(d,60,x1)\
+    m(d,59,x2) m(d,58,x3) m(d,57,x4) m(d,56,x5) m(d,55,x6) m(d,54,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M54(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M63(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,62,x0) m(d,61,x1)\
+    m(d,60,x2) m(d,59,x3) m(d,58,x4) m(d,57,x5) m(d,56,x6) m(d,55,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M55(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M64(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,63,x0) m(d,62,x1)\
+    m(d,61,x2) m(d,60,x3) m(d,59,x4) m(d,58,x5) m(d,57,x6) m(d,56,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M56(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M65(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,64,x0) m(d,63,x1)\
+    m(d,62,x2) m(d,61,x3) m(d,60,x4) m(d,59,x5) m(d,58,x6) m(d,57,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M57(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M66(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,65,x0) m(d,64,x1)\
+    m(d,63,x2) m(d,62,x3) m(d,61,x4) m(d,60,x5) m(d,59,x6) m(d,58,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M58(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M67(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,66,x0) m(d,65,x1)\
+    m(d,64,x2) m(d,63,x3) m(d,62,x4) m(d,61,x5) m(d,60,x6) m(d,59,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M59(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M68(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,67,x0) m(d,66,x1)\
+    m(d,65,x2) m(d,64,x3) m(d,63,x4) m(d,62,x5) m(d,61,x6) m(d,60,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M60(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M69(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,68,x0) m(d,67,x1)\
+    m(d,66,x2) m(d,65,x3) m(d,64,x4) m(d,63,x5) m(d,62,x6) m(d,61,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M61(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M70(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,69,x0) m(d,68,x1)\
+    m(d,67,x2) m(d,66,x3) m(d,65,x4) m(d,64,x5) m(d,63,x6) m(d,62,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M62(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M71(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,70,x0) m(d,69,x1)\
+    m(d,68,x2) m(d,67,x3) m(d,66,x4) m(d,65,x5) m(d,64,x6) m(d,63,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M63(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M72(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,71,x0) m(d,70,x1)\
+    m(d,69,x2) m(d,68,x3) m(d,67,x4) m(d,66,x5) m(d,65,x6) m(d,64,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M64(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M73(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,72,x0) m(d,71,x1)\
+    m(d,70,x2) m(d,69,x3) m(d,68,x4) m(d,67,x5) m(d,66,x6) m(d,65,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M65(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M74(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,73,x0) m(d,72,x1)\
+    m(d,71,x2) m(d,70,x3) m(d,69,x4) m(d,68,x5) m(d,67,x6) m(d,66,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M66(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M75(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,74,x0) m(d,73,x1)\
+    m(d,72,x2) m(d,71,x3) m(d,70,x4) m(d,69,x5) m(d,68,x6) m(d,67,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M67(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M76(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,75,x0) m(d,74,x1)\
+    m(d,73,x2) m(d,72,x3) m(d,71,x4) m(d,70,x5) m(d,69,x6) m(d,68,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M68(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M77(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,76,x0) m(d,75,x1)\
+    m(d,74,x2) m(d,73,x3) m(d,72,x4) m(d,71,x5) m(d,70,x6) m(d,69,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M69(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M78(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,77,x0) m(d,76,x1)\
+    m(d,75,x2) m(d,74,x3) m(d,73,x4) m(d,72,x5) m(d,71,x6) m(d,70,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M70(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M79(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,78,x0) m(d,77,x1)\
+    m(d,76,x2) m(d,75,x3) m(d,74,x4) m(d,73,x5) m(d,72,x6) m(d,71,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M71(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M80(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,79,x0) m(d,78,x1)\
+    m(d,77,x2) m(d,76,x3) m(d,75,x4) m(d,74,x5) m(d,73,x6) m(d,72,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M72(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M81(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,80,x0) m(d,79,x1)\
+    m(d,78,x2) m(d,77,x3) m(d,76,x4) m(d,75,x5) m(d,74,x6) m(d,73,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M73(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M82(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,81,x0) m(d,80,x1)\
+    m(d,79,x2) m(d,78,x3) m(d,77,x4) m(d,76,x5) m(d,75,x6) m(d,74,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M74(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M83(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,82,x0) m(d,81,x1)\
+    m(d,80,x2) m(d,79,x3) m(d,78,x4) m(d,77,x5) m(d,76,x6) m(d,75,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M75(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M84(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,83,x0) m(d,82,x1)\
+    m(d,81,x2) m(d,80,x3) m(d,79,x4) m(d,78,x5) m(d,77,x6) m(d,76,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M76(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M85(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,84,x0) m(d,83,x1)\
+    m(d,82,x2) m(d,81,x3) m(d,80,x4) m(d,79,x5) m(d,78,x6) m(d,77,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M77(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M86(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,85,x0) m(d,84,x1)\
+    m(d,83,x2) m(d,82,x3) m(d,81,x4) m(d,80,x5) m(d,79,x6) m(d,78,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M78(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M87(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,86,x0) m(d,85,x1)\
+    m(d,84,x2) m(d,83,x3) m(d,82,x4) m(d,81,x5) m(d,80,x6) m(d,79,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M79(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M88(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,87,x0) m(d,86,x1)\
+    m(d,85,x2) m(d,84,x3) m(d,83,x4) m(d,82,x5) m(d,81,x6) m(d,80,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M80(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M89(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,88,x0) m(d,87,x1)\
+    m(d,86,x2) m(d,85,x3) m(d,84,x4) m(d,83,x5) m(d,82,x6) m(d,81,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M81(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M90(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,89,x0) m(d,88,x1)\
+    m(d,87,x2) m(d,86,x3) m(d,85,x4) m(d,84,x5) m(d,83,x6) m(d,82,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M82(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M91(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,90,x0) m(d,89,x1)\
+    m(d,88,x2) m(d,87,x3) m(d,86,x4) m(d,85,x5) m(d,84,x6) m(d,83,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M83(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M92(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,91,x0) m(d,90,x1)\
+    m(d,89,x2) m(d,88,x3) m(d,87,x4) m(d,86,x5) m(d,85,x6) m(d,84,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M84(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M93(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,92,x0) m(d,91,x1)\
+    m(d,90,x2) m(d,89,x3) m(d,88,x4) m(d,87,x5) m(d,86,x6) m(d,85,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M85(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M94(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,93,x0) m(d,92,x1)\
+    m(d,91,x2) m(d,90,x3) m(d,89,x4) m(d,88,x5) m(d,87,x6) m(d,86,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M86(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M95(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,94,x0) m(d,93,x1)\
+    m(d,92,x2) m(d,91,x3) m(d,90,x4) m(d,89,x5) m(d,88,x6) m(d,87,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M87(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M96(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,95,x0) m(d,94,x1)\
+    m(d,93,x2) m(d,92,x3) m(d,91,x4) m(d,90,x5) m(d,89,x6) m(d,88,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M88(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M97(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,96,x0) m(d,95,x1)\
+    m(d,94,x2) m(d,93,x3) m(d,92,x4) m(d,91,x5) m(d,90,x6) m(d,89,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M89(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M98(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,97,x0) m(d,96,x1)\
+    m(d,95,x2) m(d,94,x3) m(d,93,x4) m(d,92,x5) m(d,91,x6) m(d,90,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M90(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M99(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,98,x0) m(d,97,x1)\
+    m(d,96,x2) m(d,95,x3) m(d,94,x4) m(d,93,x5) m(d,92,x6) m(d,91,x7)          \
+    BETTER_ENUMS_ID(BETTER_ENUMS_M91(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M100(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,99,x0)          \
+    m(d,98,x1) m(d,97,x2) m(d,96,x3) m(d,95,x4) m(d,94,x5) m(d,93,x6)          \
+    m(d,92,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M92(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M101(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,100,x0)         \
+    m(d,99,x1) m(d,98,x2) m(d,97,x3) m(d,96,x4) m(d,95,x5) m(d,94,x6)          \
+    m(d,93,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M93(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M102(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,101,x0)         \
+    m(d,100,x1) m(d,99,x2) m(d,98,x3) m(d,97,x4) m(d,96,x5) m(d,95,x6)         \
+    m(d,94,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M94(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M103(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,102,x0)         \
+    m(d,101,x1) m(d,100,x2) m(d,99,x3) m(d,98,x4) m(d,97,x5) m(d,96,x6)        \
+    m(d,95,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M95(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M104(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,103,x0)         \
+    m(d,102,x1) m(d,101,x2) m(d,100,x3) m(d,99,x4) m(d,98,x5) m(d,97,x6)       \
+    m(d,96,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M96(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M105(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,104,x0)         \
+    m(d,103,x1) m(d,102,x2) m(d,101,x3) m(d,100,x4) m(d,99,x5) m(d,98,x6)      \
+    m(d,97,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M97(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M106(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,105,x0)         \
+    m(d,104,x1) m(d,103,x2) m(d,102,x3) m(d,101,x4) m(d,100,x5) m(d,99,x6)     \
+    m(d,98,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M98(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M107(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,106,x0)         \
+    m(d,105,x1) m(d,104,x2) m(d,103,x3) m(d,102,x4) m(d,101,x5) m(d,100,x6)    \
+    m(d,99,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M99(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M108(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,107,x0)         \
+    m(d,106,x1) m(d,105,x2) m(d,104,x3) m(d,103,x4) m(d,102,x5) m(d,101,x6)    \
+    m(d,100,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M100(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M109(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,108,x0)         \
+    m(d,107,x1) m(d,106,x2) m(d,105,x3) m(d,104,x4) m(d,103,x5) m(d,102,x6)    \
+    m(d,101,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M101(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M110(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,109,x0)         \
+    m(d,108,x1) m(d,107,x2) m(d,106,x3) m(d,105,x4) m(d,104,x5) m(d,103,x6)    \
+    m(d,102,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M102(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M111(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,110,x0)         \
+    m(d,109,x1) m(d,108,x2) m(d,107,x3) m(d,106,x4) m(d,105,x5) m(d,104,x6)    \
+    m(d,103,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M103(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M112(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,111,x0)         \
+    m(d,110,x1) m(d,109,x2) m(d,108,x3) m(d,107,x4) m(d,106,x5) m(d,105,x6)    \
+    m(d,104,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M104(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M113(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,112,x0)         \
+    m(d,111,x1) m(d,110,x2) m(d,109,x3) m(d,108,x4) m(d,107,x5) m(d,106,x6)    \
+    m(d,105,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M105(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M114(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,113,x0)         \
+    m(d,112,x1) m(d,111,x2) m(d,110,x3) m(d,109,x4) m(d,108,x5) m(d,107,x6)    \
+    m(d,106,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M106(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M115(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,114,x0)         \
+    m(d,113,x1) m(d,112,x2) m(d,111,x3) m(d,110,x4) m(d,109,x5) m(d,108,x6)    \
+    m(d,107,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M107(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M116(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,115,x0)         \
+    m(d,114,x1) m(d,113,x2) m(d,112,x3) m(d,111,x4) m(d,110,x5) m(d,109,x6)    \
+    m(d,108,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M108(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M117(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,116,x0)         \
+    m(d,115,x1) m(d,114,x2) m(d,113,x3) m(d,112,x4) m(d,111,x5) m(d,110,x6)    \
+    m(d,109,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M109(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M118(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,117,x0)         \
+    m(d,116,x1) m(d,115,x2) m(d,114,x3) m(d,113,x4) m(d,112,x5) m(d,111,x6)    \
+    m(d,110,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M110(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M119(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,118,x0)         \
+    m(d,117,x1) m(d,116,x2) m(d,115,x3) m(d,114,x4) m(d,113,x5) m(d,112,x6)    \
+    m(d,111,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M111(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M120(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,119,x0)         \
+    m(d,118,x1) m(d,117,x2) m(d,116,x3) m(d,115,x4) m(d,114,x5) m(d,113,x6)    \
+    m(d,112,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M112(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M121(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,120,x0)         \
+    m(d,119,x1) m(d,118,x2) m(d,117,x3) m(d,116,x4) m(d,115,x5) m(d,114,x6)    \
+    m(d,113,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M113(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M122(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,121,x0)         \
+    m(d,120,x1) m(d,119,x2) m(d,118,x3) m(d,117,x4) m(d,116,x5) m(d,115,x6)    \
+    m(d,114,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M114(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M123(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,122,x0)         \
+    m(d,121,x1) m(d,120,x2) m(d,119,x3) m(d,118,x4) m(d,117,x5) m(d,116,x6)    \
+    m(d,115,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M115(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M124(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,123,x0)         \
+    m(d,122,x1) m(d,121,x2) m(d,120,x3) m(d,119,x4) m(d,118,x5) m(d,117,x6)    \
+    m(d,116,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M116(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M125(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,124,x0)         \
+    m(d,123,x1) m(d,122,x2) m(d,121,x3) m(d,120,x4) m(d,119,x5) m(d,118,x6)    \
+    m(d,117,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M117(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M126(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,125,x0)         \
+    m(d,124,x1) m(d,123,x2) m(d,122,x3) m(d,121,x4) m(d,120,x5) m(d,119,x6)    \
+    m(d,118,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M118(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M127(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,126,x0)         \
+    m(d,125,x1) m(d,124,x2) m(d,123,x3) m(d,122,x4) m(d,121,x5) m(d,120,x6)    \
+    m(d,119,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M119(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M128(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,127,x0)         \
+    m(d,126,x1) m(d,125,x2) m(d,124,x3) m(d,123,x4) m(d,122,x5) m(d,121,x6)    \
+    m(d,120,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M120(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M129(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,128,x0)         \
+    m(d,127,x1) m(d,126,x2) m(d,125,x3) m(d,124,x4) m(d,123,x5) m(d,122,x6)    \
+    m(d,121,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M121(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M130(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,129,x0)         \
+    m(d,128,x1) m(d,127,x2) m(d,126,x3) m(d,125,x4) m(d,124,x5) m(d,123,x6)    \
+    m(d,122,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M122(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M131(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,130,x0)         \
+    m(d,129,x1) m(d,128,x2) m(d,127,x3) m(d,126,x4) m(d,125,x5) m(d,124,x6)    \
+    m(d,123,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M123(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M132(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,131,x0)         \
+    m(d,130,x1) m(d,129,x2) m(d,128,x3) m(d,127,x4) m(d,126,x5) m(d,125,x6)    \
+    m(d,124,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M124(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M133(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,132,x0)         \
+    m(d,131,x1) m(d,130,x2) m(d,129,x3) m(d,128,x4) m(d,127,x5) m(d,126,x6)    \
+    m(d,125,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M125(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M134(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,133,x0)         \
+    m(d,132,x1) m(d,131,x2) m(d,130,x3) m(d,129,x4) m(d,128,x5) m(d,127,x6)    \
+    m(d,126,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M126(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M135(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,134,x0)         \
+    m(d,133,x1) m(d,132,x2) m(d,131,x3) m(d,130,x4) m(d,129,x5) m(d,128,x6)    \
+    m(d,127,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M127(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M136(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,135,x0)         \
+    m(d,134,x1) m(d,133,x2) m(d,132,x3) m(d,131,x4) m(d,130,x5) m(d,129,x6)    \
+    m(d,128,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M128(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M137(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,136,x0)         \
+    m(d,135,x1) m(d,134,x2) m(d,133,x3) m(d,132,x4) m(d,131,x5) m(d,130,x6)    \
+    m(d,129,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M129(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M138(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,137,x0)         \
+    m(d,136,x1) m(d,135,x2) m(d,134,x3) m(d,133,x4) m(d,132,x5) m(d,131,x6)    \
+    m(d,130,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M130(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M139(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,138,x0)         \
+    m(d,137,x1) m(d,136,x2) m(d,135,x3) m(d,134,x4) m(d,133,x5) m(d,132,x6)    \
+    m(d,131,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M131(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M140(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,139,x0)         \
+    m(d,138,x1) m(d,137,x2) m(d,136,x3) m(d,135,x4) m(d,134,x5) m(d,133,x6)    \
+    m(d,132,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M132(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M141(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,140,x0)         \
+    m(d,139,x1) m(d,138,x2) m(d,137,x3) m(d,136,x4) m(d,135,x5) m(d,134,x6)    \
+    m(d,133,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M133(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M142(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,141,x0)         \
+    m(d,140,x1) m(d,139,x2) m(d,138,x3) m(d,137,x4) m(d,136,x5) m(d,135,x6)    \
+    m(d,134,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M134(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M143(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,142,x0)         \
+    m(d,141,x1) m(d,140,x2) m(d,139,x3) m(d,138,x4) m(d,137,x5) m(d,136,x6)    \
+    m(d,135,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M135(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M144(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,143,x0)         \
+    m(d,142,x1) m(d,141,x2) m(d,140,x3) m(d,139,x4) m(d,138,x5) m(d,137,x6)    \
+    m(d,136,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M136(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M145(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,144,x0)         \
+    m(d,143,x1) m(d,142,x2) m(d,141,x3) m(d,140,x4) m(d,139,x5) m(d,138,x6)    \
+    m(d,137,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M137(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M146(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,145,x0)         \
+    m(d,144,x1) m(d,143,x2) m(d,142,x3) m(d,141,x4) m(d,140,x5) m(d,139,x6)    \
+    m(d,138,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M138(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M147(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,146,x0)         \
+    m(d,145,x1) m(d,144,x2) m(d,143,x3) m(d,142,x4) m(d,141,x5) m(d,140,x6)    \
+    m(d,139,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M139(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M148(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,147,x0)         \
+    m(d,146,x1) m(d,145,x2) m(d,144,x3) m(d,143,x4) m(d,142,x5) m(d,141,x6)    \
+    m(d,140,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M140(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M149(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,148,x0)         \
+    m(d,147,x1) m(d,146,x2) m(d,145,x3) m(d,144,x4) m(d,143,x5) m(d,142,x6)    \
+    m(d,141,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M141(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M150(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,149,x0)         \
+    m(d,148,x1) m(d,147,x2) m(d,146,x3) m(d,145,x4) m(d,144,x5) m(d,143,x6)    \
+    m(d,142,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M142(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M151(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,150,x0)         \
+    m(d,149,x1) m(d,148,x2) m(d,147,x3) m(d,146,x4) m(d,145,x5) m(d,144,x6)    \
+    m(d,143,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M143(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M152(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,151,x0)         \
+    m(d,150,x1) m(d,149,x2) m(d,148,x3) m(d,147,x4) m(d,146,x5) m(d,145,x6)    \
+    m(d,144,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M144(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M153(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,152,x0)         \
+    m(d,151,x1) m(d,150,x2) m(d,149,x3) m(d,148,x4) m(d,147,x5) m(d,146,x6)    \
+    m(d,145,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M145(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M154(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,153,x0)         \
+    m(d,152,x1) m(d,151,x2) m(d,150,x3) m(d,149,x4) m(d,148,x5) m(d,147,x6)    \
+    m(d,146,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M146(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M155(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,154,x0)         \
+    m(d,153,x1) m(d,152,x2) m(d,151,x3) m(d,150,x4) m(d,149,x5) m(d,148,x6)    \
+    m(d,147,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M147(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M156(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,155,x0)         \
+    m(d,154,x1) m(d,153,x2) m(d,152,x3) m(d,151,x4) m(d,150,x5) m(d,149,x6)    \
+    m(d,148,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M148(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M157(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,156,x0)         \
+    m(d,155,x1) m(d,154,x2) m(d,153,x3) m(d,152,x4) m(d,151,x5) m(d,150,x6)    \
+    m(d,149,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M149(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M158(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,157,x0)         \
+    m(d,156,x1) m(d,155,x2) m(d,154,x3) m(d,153,x4) m(d,152,x5) m(d,151,x6)    \
+    m(d,150,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M150(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M159(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,158,x0)         \
+    m(d,157,x1) m(d,156,x2) m(d,155,x3) m(d,154,x4) m(d,153,x5) m(d,152,x6)    \
+    m(d,151,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M151(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M160(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,159,x0)         \
+    m(d,158,x1) m(d,157,x2) m(d,156,x3) m(d,155,x4) m(d,154,x5) m(d,153,x6)    \
+    m(d,152,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M152(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M161(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,160,x0)         \
+    m(d,159,x1) m(d,158,x2) m(d,157,x3) m(d,156,x4) m(d,155,x5) m(d,154,x6)    \
+    m(d,153,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M153(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M162(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,161,x0)         \
+    m(d,160,x1) m(d,159,x2) m(d,158,x3) m(d,157,x4) m(d,156,x5) m(d,155,x6)    \
+    m(d,154,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M154(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M163(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,162,x0)         \
+    m(d,161,x1) m(d,160,x2) m(d,159,x3) m(d,158,x4) m(d,157,x5) m(d,156,x6)    \
+    m(d,155,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M155(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M164(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,163,x0)         \
+    m(d,162,x1) m(d,161,x2) m(d,160,x3) m(d,159,x4) m(d,158,x5) m(d,157,x6)    \
+    m(d,156,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M156(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M165(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,164,x0)         \
+    m(d,163,x1) m(d,162,x2) m(d,161,x3) m(d,160,x4) m(d,159,x5) m(d,158,x6)    \
+    m(d,157,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M157(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M166(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,165,x0)         \
+    m(d,164,x1) m(d,163,x2) m(d,162,x3) m(d,161,x4) m(d,160,x5) m(d,159,x6)    \
+    m(d,158,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M158(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M167(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,166,x0)         \
+    m(d,165,x1) m(d,164,x2) m(d,163,x3) m(d,162,x4) m(d,161,x5) m(d,160,x6)    \
+    m(d,159,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M159(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M168(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,167,x0)         \
+    m(d,166,x1) m(d,165,x2) m(d,164,x3) m(d,163,x4) m(d,162,x5) m(d,161,x6)    \
+    m(d,160,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M160(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M169(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,168,x0)         \
+    m(d,167,x1) m(d,166,x2) m(d,165,x3) m(d,164,x4) m(d,163,x5) m(d,162,x6)    \
+    m(d,161,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M161(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M170(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,169,x0)         \
+    m(d,168,x1) m(d,167,x2) m(d,166,x3) m(d,165,x4) m(d,164,x5) m(d,163,x6)    \
+    m(d,162,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M162(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M171(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,170,x0)         \
+    m(d,169,x1) m(d,168,x2) m(d,167,x3) m(d,166,x4) m(d,165,x5) m(d,164,x6)    \
+    m(d,163,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M163(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M172(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,171,x0)         \
+    m(d,170,x1) m(d,169,x2) m(d,168,x3) m(d,167,x4) m(d,166,x5) m(d,165,x6)    \
+    m(d,164,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M164(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M173(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,172,x0)         \
+    m(d,171,x1) m(d,170,x2) m(d,169,x3) m(d,168,x4) m(d,167,x5) m(d,166,x6)    \
+    m(d,165,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M165(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M174(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,173,x0)         \
+    m(d,172,x1) m(d,171,x2) m(d,170,x3) m(d,169,x4) m(d,168,x5) m(d,167,x6)    \
+    m(d,166,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M166(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M175(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,174,x0)         \
+    m(d,173,x1) m(d,172,x2) m(d,171,x3) m(d,170,x4) m(d,169,x5) m(d,168,x6)    \
+    m(d,167,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M167(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M176(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,175,x0)         \
+    m(d,174,x1) m(d,173,x2) m(d,172,x3) m(d,171,x4) m(d,170,x5) m(d,169,x6)    \
+    m(d,168,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M168(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M177(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,176,x0)         \
+    m(d,175,x1) m(d,174,x2) m(d,173,x3) m(d,172,x4) m(d,171,x5) m(d,170,x6)    \
+    m(d,169,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M169(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M178(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,177,x0)         \
+    m(d,176,x1) m(d,175,x2) m(d,174,x3) m(d,173,x4) m(d,172,x5) m(d,171,x6)    \
+    m(d,170,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M170(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M179(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,178,x0)         \
+    m(d,177,x1) m(d,176,x2) m(d,175,x3) m(d,174,x4) m(d,173,x5) m(d,172,x6)    \
+    m(d,171,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M171(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M180(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,179,x0)         \
+    m(d,178,x1) m(d,177,x2) m(d,176,x3) m(d,175,x4) m(d,174,x5) m(d,173,x6)    \
+    m(d,172,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M172(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M181(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,180,x0)         \
+    m(d,179,x1) m(d,178,x2) m(d,177,x3) m(d,176,x4) m(d,175,x5) m(d,174,x6)    \
+    m(d,173,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M173(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M182(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,181,x0)         \
+    m(d,180,x1) m(d,179,x2) m(d,178,x3) m(d,177,x4) m(d,176,x5) m(d,175,x6)    \
+    m(d,174,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M174(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M183(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,182,x0)         \
+    m(d,181,x1) m(d,180,x2) m(d,179,x3) m(d,178,x4) m(d,177,x5) m(d,176,x6)    \
+    m(d,175,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M175(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M184(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,183,x0)         \
+    m(d,182,x1) m(d,181,x2) m(d,180,x3) m(d,179,x4) m(d,178,x5) m(d,177,x6)    \
+    m(d,176,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M176(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M185(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,184,x0)         \
+    m(d,183,x1) m(d,182,x2) m(d,181,x3) m(d,180,x4) m(d,179,x5) m(d,178,x6)    \
+    m(d,177,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M177(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M186(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,185,x0)         \
+    m(d,184,x1) m(d,183,x2) m(d,182,x3) m(d,181,x4) m(d,180,x5) m(d,179,x6)    \
+    m(d,178,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M178(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M187(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,186,x0)         \
+    m(d,185,x1) m(d,184,x2) m(d,183,x3) m(d,182,x4) m(d,181,x5) m(d,180,x6)    \
+    m(d,179,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M179(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M188(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,187,x0)         \
+    m(d,186,x1) m(d,185,x2) m(d,184,x3) m(d,183,x4) m(d,182,x5) m(d,181,x6)    \
+    m(d,180,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M180(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M189(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,188,x0)         \
+    m(d,187,x1) m(d,186,x2) m(d,185,x3) m(d,184,x4) m(d,183,x5) m(d,182,x6)    \
+    m(d,181,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M181(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M190(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,189,x0)         \
+    m(d,188,x1) m(d,187,x2) m(d,186,x3) m(d,185,x4) m(d,184,x5) m(d,183,x6)    \
+    m(d,182,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M182(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M191(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,190,x0)         \
+    m(d,189,x1) m(d,188,x2) m(d,187,x3) m(d,186,x4) m(d,185,x5) m(d,184,x6)    \
+    m(d,183,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M183(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M192(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,191,x0)         \
+    m(d,190,x1) m(d,189,x2) m(d,188,x3) m(d,187,x4) m(d,186,x5) m(d,185,x6)    \
+    m(d,184,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M184(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M193(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,192,x0)         \
+    m(d,191,x1) m(d,190,x2) m(d,189,x3) m(d,188,x4) m(d,187,x5) m(d,186,x6)    \
+    m(d,185,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M185(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M194(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,193,x0)         \
+    m(d,192,x1) m(d,191,x2) m(d,190,x3) m(d,189,x4) m(d,188,x5) m(d,187,x6)    \
+    m(d,186,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M186(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M195(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,194,x0)         \
+    m(d,193,x1) m(d,192,x2) m(d,191,x3) m(d,190,x4) m(d,189,x5) m(d,188,x6)    \
+    m(d,187,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M187(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M196(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,195,x0)         \
+    m(d,194,x1) m(d,193,x2) m(d,192,x3) m(d,191,x4) m(d,190,x5) m(d,189,x6)    \
+    m(d,188,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M188(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M197(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,196,x0)         \
+    m(d,195,x1) m(d,194,x2) m(d,193,x3) m(d,192,x4) m(d,191,x5) m(d,190,x6)    \
+    m(d,189,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M189(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M198(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,197,x0)         \
+    m(d,196,x1) m(d,195,x2) m(d,194,x3) m(d,193,x4) m(d,192,x5) m(d,191,x6)    \
+    m(d,190,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M190(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M199(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,198,x0)         \
+    m(d,197,x1) m(d,196,x2) m(d,195,x3) m(d,194,x4) m(d,193,x5) m(d,192,x6)    \
+    m(d,191,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M191(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M200(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,199,x0)         \
+    m(d,198,x1) m(d,197,x2) m(d,196,x3) m(d,195,x4) m(d,194,x5) m(d,193,x6)    \
+    m(d,192,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M192(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M201(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,200,x0)         \
+    m(d,199,x1) m(d,198,x2) m(d,197,x3) m(d,196,x4) m(d,195,x5) m(d,194,x6)    \
+    m(d,193,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M193(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M202(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,201,x0)         \
+    m(d,200,x1) m(d,199,x2) m(d,198,x3) m(d,197,x4) m(d,196,x5) m(d,195,x6)    \
+    m(d,194,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M194(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M203(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,202,x0)         \
+    m(d,201,x1) m(d,200,x2) m(d,199,x3) m(d,198,x4) m(d,197,x5) m(d,196,x6)    \
+    m(d,195,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M195(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M204(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,203,x0)         \
+    m(d,202,x1) m(d,201,x2) m(d,200,x3) m(d,199,x4) m(d,198,x5) m(d,197,x6)    \
+    m(d,196,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M196(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M205(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,204,x0)         \
+    m(d,203,x1) m(d,202,x2) m(d,201,x3) m(d,200,x4) m(d,199,x5) m(d,198,x6)    \
+    m(d,197,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M197(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M206(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,205,x0)         \
+    m(d,204,x1) m(d,203,x2) m(d,202,x3) m(d,201,x4) m(d,200,x5) m(d,199,x6)    \
+    m(d,198,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M198(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M207(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,206,x0)         \
+    m(d,205,x1) m(d,204,x2) m(d,203,x3) m(d,202,x4) m(d,201,x5) m(d,200,x6)    \
+    m(d,199,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M199(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M208(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,207,x0)         \
+    m(d,206,x1) m(d,205,x2) m(d,204,x3) m(d,203,x4) m(d,202,x5) m(d,201,x6)    \
+    m(d,200,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M200(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M209(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,208,x0)         \
+    m(d,207,x1) m(d,206,x2) m(d,205,x3) m(d,204,x4) m(d,203,x5) m(d,202,x6)    \
+    m(d,201,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M201(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M210(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,209,x0)         \
+    m(d,208,x1) m(d,207,x2) m(d,206,x3) m(d,205,x4) m(d,204,x5) m(d,203,x6)    \
+    m(d,202,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M202(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M211(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,210,x0)         \
+    m(d,209,x1) m(d,208,x2) m(d,207,x3) m(d,206,x4) m(d,205,x5) m(d,204,x6)    \
+    m(d,203,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M203(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M212(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,211,x0)         \
+    m(d,210,x1) m(d,209,x2) m(d,208,x3) m(d,207,x4) m(d,206,x5) m(d,205,x6)    \
+    m(d,204,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M204(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M213(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,212,x0)         \
+    m(d,211,x1) m(d,210,x2) m(d,209,x3) m(d,208,x4) m(d,207,x5) m(d,206,x6)    \
+    m(d,205,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M205(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M214(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,213,x0)         \
+    m(d,212,x1) m(d,211,x2) m(d,210,x3) m(d,209,x4) m(d,208,x5) m(d,207,x6)    \
+    m(d,206,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M206(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M215(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,214,x0)         \
+    m(d,213,x1) m(d,212,x2) m(d,211,x3) m(d,210,x4) m(d,209,x5) m(d,208,x6)    \
+    m(d,207,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M207(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M216(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,215,x0)         \
+    m(d,214,x1) m(d,213,x2) m(d,212,x3) m(d,211,x4) m(d,210,x5) m(d,209,x6)    \
+    m(d,208,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M208(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M217(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,216,x0)         \
+    m(d,215,x1) m(d,214,x2) m(d,213,x3) m(d,212,x4) m(d,211,x5) m(d,210,x6)    \
+    m(d,209,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M209(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M218(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,217,x0)         \
+    m(d,216,x1) m(d,215,x2) m(d,214,x3) m(d,213,x4) m(d,212,x5) m(d,211,x6)    \
+    m(d,210,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M210(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M219(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,218,x0)         \
+    m(d,217,x1) m(d,216,x2) m(d,215,x3) m(d,214,x4) m(d,213,x5) m(d,212,x6)    \
+    m(d,211,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M211(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M220(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,219,x0)         \
+    m(d,218,x1) m(d,217,x2) m(d,216,x3) m(d,215,x4) m(d,214,x5) m(d,213,x6)    \
+    m(d,212,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M212(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M221(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,220,x0)         \
+    m(d,219,x1) m(d,218,x2) m(d,217,x3) m(d,216,x4) m(d,215,x5) m(d,214,x6)    \
+    m(d,213,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M213(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M222(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,221,x0)         \
+    m(d,220,x1) m(d,219,x2) m(d,218,x3) m(d,217,x4) m(d,216,x5) m(d,215,x6)    \
+    m(d,214,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M214(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M223(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,222,x0)         \
+    m(d,221,x1) m(d,220,x2) m(d,219,x3) m(d,218,x4) m(d,217,x5) m(d,216,x6)    \
+    m(d,215,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M215(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M224(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,223,x0)         \
+    m(d,222,x1) m(d,221,x2) m(d,220,x3) m(d,219,x4) m(d,218,x5) m(d,217,x6)    \
+    m(d,216,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M216(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M225(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,224,x0)         \
+    m(d,223,x1) m(d,222,x2) m(d,221,x3) m(d,220,x4) m(d,219,x5) m(d,218,x6)    \
+    m(d,217,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M217(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M226(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,225,x0)         \
+    m(d,224,x1) m(d,223,x2) m(d,222,x3) m(d,221,x4) m(d,220,x5) m(d,219,x6)    \
+    m(d,218,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M218(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M227(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,226,x0)         \
+    m(d,225,x1) m(d,224,x2) m(d,223,x3) m(d,222,x4) m(d,221,x5) m(d,220,x6)    \
+    m(d,219,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M219(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M228(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,227,x0)         \
+    m(d,226,x1) m(d,225,x2) m(d,224,x3) m(d,223,x4) m(d,222,x5) m(d,221,x6)    \
+    m(d,220,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M220(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M229(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,228,x0)         \
+    m(d,227,x1) m(d,226,x2) m(d,225,x3) m(d,224,x4) m(d,223,x5) m(d,222,x6)    \
+    m(d,221,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M221(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M230(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,229,x0)         \
+    m(d,228,x1) m(d,227,x2) m(d,226,x3) m(d,225,x4) m(d,224,x5) m(d,223,x6)    \
+    m(d,222,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M222(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M231(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,230,x0)         \
+    m(d,229,x1) m(d,228,x2) m(d,227,x3) m(d,226,x4) m(d,225,x5) m(d,224,x6)    \
+    m(d,223,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M223(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M232(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,231,x0)         \
+    m(d,230,x1) m(d,229,x2) m(d,228,x3) m(d,227,x4) m(d,226,x5) m(d,225,x6)    \
+    m(d,224,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M224(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M233(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,232,x0)         \
+    m(d,231,x1) m(d,230,x2) m(d,229,x3) m(d,228,x4) m(d,227,x5) m(d,226,x6)    \
+    m(d,225,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M225(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M234(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,233,x0)         \
+    m(d,232,x1) m(d,231,x2) m(d,230,x3) m(d,229,x4) m(d,228,x5) m(d,227,x6)    \
+    m(d,226,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M226(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M235(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,234,x0)         \
+    m(d,233,x1) m(d,232,x2) m(d,231,x3) m(d,230,x4) m(d,229,x5) m(d,228,x6)    \
+    m(d,227,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M227(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M236(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,235,x0)         \
+    m(d,234,x1) m(d,233,x2) m(d,232,x3) m(d,231,x4) m(d,230,x5) m(d,229,x6)    \
+    m(d,228,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M228(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M237(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,236,x0)         \
+    m(d,235,x1) m(d,234,x2) m(d,233,x3) m(d,232,x4) m(d,231,x5) m(d,230,x6)    \
+    m(d,229,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M229(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M238(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,237,x0)         \
+    m(d,236,x1) m(d,235,x2) m(d,234,x3) m(d,233,x4) m(d,232,x5) m(d,231,x6)    \
+    m(d,230,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M230(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M239(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,238,x0)         \
+    m(d,237,x1) m(d,236,x2) m(d,235,x3) m(d,234,x4) m(d,233,x5) m(d,232,x6)    \
+    m(d,231,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M231(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M240(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,239,x0)         \
+    m(d,238,x1) m(d,237,x2) m(d,236,x3) m(d,235,x4) m(d,234,x5) m(d,233,x6)    \
+    m(d,232,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M232(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M241(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,240,x0)         \
+    m(d,239,x1) m(d,238,x2) m(d,237,x3) m(d,236,x4) m(d,235,x5) m(d,234,x6)    \
+    m(d,233,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M233(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M242(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,241,x0)         \
+    m(d,240,x1) m(d,239,x2) m(d,238,x3) m(d,237,x4) m(d,236,x5) m(d,235,x6)    \
+    m(d,234,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M234(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M243(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,242,x0)         \
+    m(d,241,x1) m(d,240,x2) m(d,239,x3) m(d,238,x4) m(d,237,x5) m(d,236,x6)    \
+    m(d,235,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M235(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M244(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,243,x0)         \
+    m(d,242,x1) m(d,241,x2) m(d,240,x3) m(d,239,x4) m(d,238,x5) m(d,237,x6)    \
+    m(d,236,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M236(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M245(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,244,x0)         \
+    m(d,243,x1) m(d,242,x2) m(d,241,x3) m(d,240,x4) m(d,239,x5) m(d,238,x6)    \
+    m(d,237,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M237(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M246(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,245,x0)         \
+    m(d,244,x1) m(d,243,x2) m(d,242,x3) m(d,241,x4) m(d,240,x5) m(d,239,x6)    \
+    m(d,238,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M238(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M247(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,246,x0)         \
+    m(d,245,x1) m(d,244,x2) m(d,243,x3) m(d,242,x4) m(d,241,x5) m(d,240,x6)    \
+    m(d,239,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M239(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M248(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,247,x0)         \
+    m(d,246,x1) m(d,245,x2) m(d,244,x3) m(d,243,x4) m(d,242,x5) m(d,241,x6)    \
+    m(d,240,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M240(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M249(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,248,x0)         \
+    m(d,247,x1) m(d,246,x2) m(d,245,x3) m(d,244,x4) m(d,243,x5) m(d,242,x6)    \
+    m(d,241,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M241(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M250(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,249,x0)         \
+    m(d,248,x1) m(d,247,x2) m(d,246,x3) m(d,245,x4) m(d,244,x5) m(d,243,x6)    \
+    m(d,242,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M242(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M251(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,250,x0)         \
+    m(d,249,x1) m(d,248,x2) m(d,247,x3) m(d,246,x4) m(d,245,x5) m(d,244,x6)    \
+    m(d,243,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M243(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M252(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,251,x0)         \
+    m(d,250,x1) m(d,249,x2) m(d,248,x3) m(d,247,x4) m(d,246,x5) m(d,245,x6)    \
+    m(d,244,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M244(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M253(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,252,x0)         \
+    m(d,251,x1) m(d,250,x2) m(d,249,x3) m(d,248,x4) m(d,247,x5) m(d,246,x6)    \
+    m(d,245,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M245(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M254(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,253,x0)         \
+    m(d,252,x1) m(d,251,x2) m(d,250,x3) m(d,249,x4) m(d,248,x5) m(d,247,x6)    \
+    m(d,246,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M246(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M255(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,254,x0)         \
+    m(d,253,x1) m(d,252,x2) m(d,251,x3) m(d,250,x4) m(d,249,x5) m(d,248,x6)    \
+    m(d,247,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M247(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M256(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,255,x0)         \
+    m(d,254,x1) m(d,253,x2) m(d,252,x3) m(d,251,x4) m(d,250,x5) m(d,249,x6)    \
+    m(d,248,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M248(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M257(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,256,x0)         \
+    m(d,255,x1) m(d,254,x2) m(d,253,x3) m(d,252,x4) m(d,251,x5) m(d,250,x6)    \
+    m(d,249,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M249(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M258(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,257,x0)         \
+    m(d,256,x1) m(d,255,x2) m(d,254,x3) m(d,253,x4) m(d,252,x5) m(d,251,x6)    \
+    m(d,250,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M250(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M259(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,258,x0)         \
+    m(d,257,x1) m(d,256,x2) m(d,255,x3) m(d,254,x4) m(d,253,x5) m(d,252,x6)    \
+    m(d,251,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M251(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M260(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,259,x0)         \
+    m(d,258,x1) m(d,257,x2) m(d,256,x3) m(d,255,x4) m(d,254,x5) m(d,253,x6)    \
+    m(d,252,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M252(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M261(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,260,x0)         \
+    m(d,259,x1) m(d,258,x2) m(d,257,x3) m(d,256,x4) m(d,255,x5) m(d,254,x6)    \
+    m(d,253,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M253(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M262(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,261,x0)         \
+    m(d,260,x1) m(d,259,x2) m(d,258,x3) m(d,257,x4) m(d,256,x5) m(d,255,x6)    \
+    m(d,254,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M254(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M263(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,262,x0)         \
+    m(d,261,x1) m(d,260,x2) m(d,259,x3) m(d,258,x4) m(d,257,x5) m(d,256,x6)    \
+    m(d,255,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M255(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M264(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,263,x0)         \
+    m(d,262,x1) m(d,261,x2) m(d,260,x3) m(d,259,x4) m(d,258,x5) m(d,257,x6)    \
+    m(d,256,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M256(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M265(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,264,x0)         \
+    m(d,263,x1) m(d,262,x2) m(d,261,x3) m(d,260,x4) m(d,259,x5) m(d,258,x6)    \
+    m(d,257,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M257(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M266(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,265,x0)         \
+    m(d,264,x1) m(d,263,x2) m(d,262,x3) m(d,261,x4) m(d,260,x5) m(d,259,x6)    \
+    m(d,258,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M258(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M267(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,266,x0)         \
+    m(d,265,x1) m(d,264,x2) m(d,263,x3) m(d,262,x4) m(d,261,x5) m(d,260,x6)    \
+    m(d,259,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M259(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M268(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,267,x0)         \
+    m(d,266,x1) m(d,265,x2) m(d,264,x3) m(d,263,x4) m(d,262,x5) m(d,261,x6)    \
+    m(d,260,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M260(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M269(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,268,x0)         \
+    m(d,267,x1) m(d,266,x2) m(d,265,x3) m(d,264,x4) m(d,263,x5) m(d,262,x6)    \
+    m(d,261,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M261(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M270(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,269,x0)         \
+    m(d,268,x1) m(d,267,x2) m(d,266,x3) m(d,265,x4) m(d,264,x5) m(d,263,x6)    \
+    m(d,262,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M262(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M271(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,270,x0)         \
+    m(d,269,x1) m(d,268,x2) m(d,267,x3) m(d,266,x4) m(d,265,x5) m(d,264,x6)    \
+    m(d,263,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M263(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M272(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,271,x0)         \
+    m(d,270,x1) m(d,269,x2) m(d,268,x3) m(d,267,x4) m(d,266,x5) m(d,265,x6)    \
+    m(d,264,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M264(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M273(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,272,x0)         \
+    m(d,271,x1) m(d,270,x2) m(d,269,x3) m(d,268,x4) m(d,267,x5) m(d,266,x6)    \
+    m(d,265,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M265(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M274(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,273,x0)         \
+    m(d,272,x1) m(d,271,x2) m(d,270,x3) m(d,269,x4) m(d,268,x5) m(d,267,x6)    \
+    m(d,266,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M266(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M275(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,274,x0)         \
+    m(d,273,x1) m(d,272,x2) m(d,271,x3) m(d,270,x4) m(d,269,x5) m(d,268,x6)    \
+    m(d,267,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M267(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M276(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,275,x0)         \
+    m(d,274,x1) m(d,273,x2) m(d,272,x3) m(d,271,x4) m(d,270,x5) m(d,269,x6)    \
+    m(d,268,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M268(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M277(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,276,x0)         \
+    m(d,275,x1) m(d,274,x2) m(d,273,x3) m(d,272,x4) m(d,271,x5) m(d,270,x6)    \
+    m(d,269,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M269(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M278(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,277,x0)         \
+    m(d,276,x1) m(d,275,x2) m(d,274,x3) m(d,273,x4) m(d,272,x5) m(d,271,x6)    \
+    m(d,270,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M270(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M279(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,278,x0)         \
+    m(d,277,x1) m(d,276,x2) m(d,275,x3) m(d,274,x4) m(d,273,x5) m(d,272,x6)    \
+    m(d,271,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M271(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M280(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,279,x0)         \
+    m(d,278,x1) m(d,277,x2) m(d,276,x3) m(d,275,x4) m(d,274,x5) m(d,273,x6)    \
+    m(d,272,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M272(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M281(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,280,x0)         \
+    m(d,279,x1) m(d,278,x2) m(d,277,x3) m(d,276,x4) m(d,275,x5) m(d,274,x6)    \
+    m(d,273,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M273(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M282(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,281,x0)         \
+    m(d,280,x1) m(d,279,x2) m(d,278,x3) m(d,277,x4) m(d,276,x5) m(d,275,x6)    \
+    m(d,274,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M274(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M283(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,282,x0)         \
+    m(d,281,x1) m(d,280,x2) m(d,279,x3) m(d,278,x4) m(d,277,x5) m(d,276,x6)    \
+    m(d,275,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M275(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M284(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,283,x0)         \
+    m(d,282,x1) m(d,281,x2) m(d,280,x3) m(d,279,x4) m(d,278,x5) m(d,277,x6)    \
+    m(d,276,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M276(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M285(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,284,x0)         \
+    m(d,283,x1) m(d,282,x2) m(d,281,x3) m(d,280,x4) m(d,279,x5) m(d,278,x6)    \
+    m(d,277,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M277(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M286(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,285,x0)         \
+    m(d,284,x1) m(d,283,x2) m(d,282,x3) m(d,281,x4) m(d,280,x5) m(d,279,x6)    \
+    m(d,278,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M278(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M287(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,286,x0)         \
+    m(d,285,x1) m(d,284,x2) m(d,283,x3) m(d,282,x4) m(d,281,x5) m(d,280,x6)    \
+    m(d,279,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M279(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M288(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,287,x0)         \
+    m(d,286,x1) m(d,285,x2) m(d,284,x3) m(d,283,x4) m(d,282,x5) m(d,281,x6)    \
+    m(d,280,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M280(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M289(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,288,x0)         \
+    m(d,287,x1) m(d,286,x2) m(d,285,x3) m(d,284,x4) m(d,283,x5) m(d,282,x6)    \
+    m(d,281,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M281(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M290(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,289,x0)         \
+    m(d,288,x1) m(d,287,x2) m(d,286,x3) m(d,285,x4) m(d,284,x5) m(d,283,x6)    \
+    m(d,282,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M282(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M291(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,290,x0)         \
+    m(d,289,x1) m(d,288,x2) m(d,287,x3) m(d,286,x4) m(d,285,x5) m(d,284,x6)    \
+    m(d,283,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M283(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M292(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,291,x0)         \
+    m(d,290,x1) m(d,289,x2) m(d,288,x3) m(d,287,x4) m(d,286,x5) m(d,285,x6)    \
+    m(d,284,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M284(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M293(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,292,x0)         \
+    m(d,291,x1) m(d,290,x2) m(d,289,x3) m(d,288,x4) m(d,287,x5) m(d,286,x6)    \
+    m(d,285,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M285(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M294(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,293,x0)         \
+    m(d,292,x1) m(d,291,x2) m(d,290,x3) m(d,289,x4) m(d,288,x5) m(d,287,x6)    \
+    m(d,286,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M286(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M295(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,294,x0)         \
+    m(d,293,x1) m(d,292,x2) m(d,291,x3) m(d,290,x4) m(d,289,x5) m(d,288,x6)    \
+    m(d,287,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M287(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M296(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,295,x0)         \
+    m(d,294,x1) m(d,293,x2) m(d,292,x3) m(d,291,x4) m(d,290,x5) m(d,289,x6)    \
+    m(d,288,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M288(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M297(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,296,x0)         \
+    m(d,295,x1) m(d,294,x2) m(d,293,x3) m(d,292,x4) m(d,291,x5) m(d,290,x6)    \
+    m(d,289,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M289(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M298(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,297,x0)         \
+    m(d,296,x1) m(d,295,x2) m(d,294,x3) m(d,293,x4) m(d,292,x5) m(d,291,x6)    \
+    m(d,290,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M290(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M299(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,298,x0)         \
+    m(d,297,x1) m(d,296,x2) m(d,295,x3) m(d,294,x4) m(d,293,x5) m(d,292,x6)    \
+    m(d,291,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M291(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M300(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,299,x0)         \
+    m(d,298,x1) m(d,297,x2) m(d,296,x3) m(d,295,x4) m(d,294,x5) m(d,293,x6)    \
+    m(d,292,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M292(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M301(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,300,x0)         \
+    m(d,299,x1) m(d,298,x2) m(d,297,x3) m(d,296,x4) m(d,295,x5) m(d,294,x6)    \
+    m(d,293,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M293(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M302(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,301,x0)         \
+    m(d,300,x1) m(d,299,x2) m(d,298,x3) m(d,297,x4) m(d,296,x5) m(d,295,x6)    \
+    m(d,294,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M294(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M303(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,302,x0)         \
+    m(d,301,x1) m(d,300,x2) m(d,299,x3) m(d,298,x4) m(d,297,x5) m(d,296,x6)    \
+    m(d,295,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M295(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M304(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,303,x0)         \
+    m(d,302,x1) m(d,301,x2) m(d,300,x3) m(d,299,x4) m(d,298,x5) m(d,297,x6)    \
+    m(d,296,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M296(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M305(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,304,x0)         \
+    m(d,303,x1) m(d,302,x2) m(d,301,x3) m(d,300,x4) m(d,299,x5) m(d,298,x6)    \
+    m(d,297,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M297(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M306(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,305,x0)         \
+    m(d,304,x1) m(d,303,x2) m(d,302,x3) m(d,301,x4) m(d,300,x5) m(d,299,x6)    \
+    m(d,298,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M298(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M307(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,306,x0)         \
+    m(d,305,x1) m(d,304,x2) m(d,303,x3) m(d,302,x4) m(d,301,x5) m(d,300,x6)    \
+    m(d,299,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M299(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M308(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,307,x0)         \
+    m(d,306,x1) m(d,305,x2) m(d,304,x3) m(d,303,x4) m(d,302,x5) m(d,301,x6)    \
+    m(d,300,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M300(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M309(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,308,x0)         \
+    m(d,307,x1) m(d,306,x2) m(d,305,x3) m(d,304,x4) m(d,303,x5) m(d,302,x6)    \
+    m(d,301,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M301(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M310(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,309,x0)         \
+    m(d,308,x1) m(d,307,x2) m(d,306,x3) m(d,305,x4) m(d,304,x5) m(d,303,x6)    \
+    m(d,302,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M302(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M311(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,310,x0)         \
+    m(d,309,x1) m(d,308,x2) m(d,307,x3) m(d,306,x4) m(d,305,x5) m(d,304,x6)    \
+    m(d,303,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M303(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M312(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,311,x0)         \
+    m(d,310,x1) m(d,309,x2) m(d,308,x3) m(d,307,x4) m(d,306,x5) m(d,305,x6)    \
+    m(d,304,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M304(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M313(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,312,x0)         \
+    m(d,311,x1) m(d,310,x2) m(d,309,x3) m(d,308,x4) m(d,307,x5) m(d,306,x6)    \
+    m(d,305,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M305(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M314(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,313,x0)         \
+    m(d,312,x1) m(d,311,x2) m(d,310,x3) m(d,309,x4) m(d,308,x5) m(d,307,x6)    \
+    m(d,306,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M306(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M315(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,314,x0)         \
+    m(d,313,x1) m(d,312,x2) m(d,311,x3) m(d,310,x4) m(d,309,x5) m(d,308,x6)    \
+    m(d,307,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M307(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M316(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,315,x0)         \
+    m(d,314,x1) m(d,313,x2) m(d,312,x3) m(d,311,x4) m(d,310,x5) m(d,309,x6)    \
+    m(d,308,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M308(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M317(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,316,x0)         \
+    m(d,315,x1) m(d,314,x2) m(d,313,x3) m(d,312,x4) m(d,311,x5) m(d,310,x6)    \
+    m(d,309,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M309(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M318(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,317,x0)         \
+    m(d,316,x1) m(d,315,x2) m(d,314,x3) m(d,313,x4) m(d,312,x5) m(d,311,x6)    \
+    m(d,310,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M310(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M319(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,318,x0)         \
+    m(d,317,x1) m(d,316,x2) m(d,315,x3) m(d,314,x4) m(d,313,x5) m(d,312,x6)    \
+    m(d,311,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M311(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M320(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,319,x0)         \
+    m(d,318,x1) m(d,317,x2) m(d,316,x3) m(d,315,x4) m(d,314,x5) m(d,313,x6)    \
+    m(d,312,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M312(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M321(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,320,x0)         \
+    m(d,319,x1) m(d,318,x2) m(d,317,x3) m(d,316,x4) m(d,315,x5) m(d,314,x6)    \
+    m(d,313,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M313(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M322(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,321,x0)         \
+    m(d,320,x1) m(d,319,x2) m(d,318,x3) m(d,317,x4) m(d,316,x5) m(d,315,x6)    \
+    m(d,314,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M314(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M323(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,322,x0)         \
+    m(d,321,x1) m(d,320,x2) m(d,319,x3) m(d,318,x4) m(d,317,x5) m(d,316,x6)    \
+    m(d,315,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M315(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M324(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,323,x0)         \
+    m(d,322,x1) m(d,321,x2) m(d,320,x3) m(d,319,x4) m(d,318,x5) m(d,317,x6)    \
+    m(d,316,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M316(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M325(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,324,x0)         \
+    m(d,323,x1) m(d,322,x2) m(d,321,x3) m(d,320,x4) m(d,319,x5) m(d,318,x6)    \
+    m(d,317,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M317(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M326(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,325,x0)         \
+    m(d,324,x1) m(d,323,x2) m(d,322,x3) m(d,321,x4) m(d,320,x5) m(d,319,x6)    \
+    m(d,318,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M318(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M327(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,326,x0)         \
+    m(d,325,x1) m(d,324,x2) m(d,323,x3) m(d,322,x4) m(d,321,x5) m(d,320,x6)    \
+    m(d,319,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M319(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M328(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,327,x0)         \
+    m(d,326,x1) m(d,325,x2) m(d,324,x3) m(d,323,x4) m(d,322,x5) m(d,321,x6)    \
+    m(d,320,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M320(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M329(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,328,x0)         \
+    m(d,327,x1) m(d,326,x2) m(d,325,x3) m(d,324,x4) m(d,323,x5) m(d,322,x6)    \
+    m(d,321,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M321(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M330(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,329,x0)         \
+    m(d,328,x1) m(d,327,x2) m(d,326,x3) m(d,325,x4) m(d,324,x5) m(d,323,x6)    \
+    m(d,322,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M322(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M331(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,330,x0)         \
+    m(d,329,x1) m(d,328,x2) m(d,327,x3) m(d,326,x4) m(d,325,x5) m(d,324,x6)    \
+    m(d,323,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M323(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M332(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,331,x0)         \
+    m(d,330,x1) m(d,329,x2) m(d,328,x3) m(d,327,x4) m(d,326,x5) m(d,325,x6)    \
+    m(d,324,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M324(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M333(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,332,x0)         \
+    m(d,331,x1) m(d,330,x2) m(d,329,x3) m(d,328,x4) m(d,327,x5) m(d,326,x6)    \
+    m(d,325,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M325(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M334(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,333,x0)         \
+    m(d,332,x1) m(d,331,x2) m(d,330,x3) m(d,329,x4) m(d,328,x5) m(d,327,x6)    \
+    m(d,326,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M326(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M335(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,334,x0)         \
+    m(d,333,x1) m(d,332,x2) m(d,331,x3) m(d,330,x4) m(d,329,x5) m(d,328,x6)    \
+    m(d,327,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M327(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M336(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,335,x0)         \
+    m(d,334,x1) m(d,333,x2) m(d,332,x3) m(d,331,x4) m(d,330,x5) m(d,329,x6)    \
+    m(d,328,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M328(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M337(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,336,x0)         \
+    m(d,335,x1) m(d,334,x2) m(d,333,x3) m(d,332,x4) m(d,331,x5) m(d,330,x6)    \
+    m(d,329,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M329(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M338(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,337,x0)         \
+    m(d,336,x1) m(d,335,x2) m(d,334,x3) m(d,333,x4) m(d,332,x5) m(d,331,x6)    \
+    m(d,330,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M330(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M339(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,338,x0)         \
+    m(d,337,x1) m(d,336,x2) m(d,335,x3) m(d,334,x4) m(d,333,x5) m(d,332,x6)    \
+    m(d,331,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M331(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M340(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,339,x0)         \
+    m(d,338,x1) m(d,337,x2) m(d,336,x3) m(d,335,x4) m(d,334,x5) m(d,333,x6)    \
+    m(d,332,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M332(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M341(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,340,x0)         \
+    m(d,339,x1) m(d,338,x2) m(d,337,x3) m(d,336,x4) m(d,335,x5) m(d,334,x6)    \
+    m(d,333,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M333(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M342(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,341,x0)         \
+    m(d,340,x1) m(d,339,x2) m(d,338,x3) m(d,337,x4) m(d,336,x5) m(d,335,x6)    \
+    m(d,334,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M334(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M343(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,342,x0)         \
+    m(d,341,x1) m(d,340,x2) m(d,339,x3) m(d,338,x4) m(d,337,x5) m(d,336,x6)    \
+    m(d,335,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M335(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M344(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,343,x0)         \
+    m(d,342,x1) m(d,341,x2) m(d,340,x3) m(d,339,x4) m(d,338,x5) m(d,337,x6)    \
+    m(d,336,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M336(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M345(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,344,x0)         \
+    m(d,343,x1) m(d,342,x2) m(d,341,x3) m(d,340,x4) m(d,339,x5) m(d,338,x6)    \
+    m(d,337,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M337(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M346(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,345,x0)         \
+    m(d,344,x1) m(d,343,x2) m(d,342,x3) m(d,341,x4) m(d,340,x5) m(d,339,x6)    \
+    m(d,338,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M338(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M347(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,346,x0)         \
+    m(d,345,x1) m(d,344,x2) m(d,343,x3) m(d,342,x4) m(d,341,x5) m(d,340,x6)    \
+    m(d,339,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M339(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M348(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,347,x0)         \
+    m(d,346,x1) m(d,345,x2) m(d,344,x3) m(d,343,x4) m(d,342,x5) m(d,341,x6)    \
+    m(d,340,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M340(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M349(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,348,x0)         \
+    m(d,347,x1) m(d,346,x2) m(d,345,x3) m(d,344,x4) m(d,343,x5) m(d,342,x6)    \
+    m(d,341,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M341(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M350(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,349,x0)         \
+    m(d,348,x1) m(d,347,x2) m(d,346,x3) m(d,345,x4) m(d,344,x5) m(d,343,x6)    \
+    m(d,342,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M342(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M351(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,350,x0)         \
+    m(d,349,x1) m(d,348,x2) m(d,347,x3) m(d,346,x4) m(d,345,x5) m(d,344,x6)    \
+    m(d,343,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M343(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M352(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,351,x0)         \
+    m(d,350,x1) m(d,349,x2) m(d,348,x3) m(d,347,x4) m(d,346,x5) m(d,345,x6)    \
+    m(d,344,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M344(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M353(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,352,x0)         \
+    m(d,351,x1) m(d,350,x2) m(d,349,x3) m(d,348,x4) m(d,347,x5) m(d,346,x6)    \
+    m(d,345,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M345(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M354(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,353,x0)         \
+    m(d,352,x1) m(d,351,x2) m(d,350,x3) m(d,349,x4) m(d,348,x5) m(d,347,x6)    \
+    m(d,346,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M346(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M355(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,354,x0)         \
+    m(d,353,x1) m(d,352,x2) m(d,351,x3) m(d,350,x4) m(d,349,x5) m(d,348,x6)    \
+    m(d,347,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M347(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M356(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,355,x0)         \
+    m(d,354,x1) m(d,353,x2) m(d,352,x3) m(d,351,x4) m(d,350,x5) m(d,349,x6)    \
+    m(d,348,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M348(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M357(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,356,x0)         \
+    m(d,355,x1) m(d,354,x2) m(d,353,x3) m(d,352,x4) m(d,351,x5) m(d,350,x6)    \
+    m(d,349,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M349(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M358(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,357,x0)         \
+    m(d,356,x1) m(d,355,x2) m(d,354,x3) m(d,353,x4) m(d,352,x5) m(d,351,x6)    \
+    m(d,350,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M350(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M359(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,358,x0)         \
+    m(d,357,x1) m(d,356,x2) m(d,355,x3) m(d,354,x4) m(d,353,x5) m(d,352,x6)    \
+    m(d,351,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M351(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M360(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,359,x0)         \
+    m(d,358,x1) m(d,357,x2) m(d,356,x3) m(d,355,x4) m(d,354,x5) m(d,353,x6)    \
+    m(d,352,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M352(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M361(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,360,x0)         \
+    m(d,359,x1) m(d,358,x2) m(d,357,x3) m(d,356,x4) m(d,355,x5) m(d,354,x6)    \
+    m(d,353,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M353(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M362(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,361,x0)         \
+    m(d,360,x1) m(d,359,x2) m(d,358,x3) m(d,357,x4) m(d,356,x5) m(d,355,x6)    \
+    m(d,354,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M354(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M363(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,362,x0)         \
+    m(d,361,x1) m(d,360,x2) m(d,359,x3) m(d,358,x4) m(d,357,x5) m(d,356,x6)    \
+    m(d,355,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M355(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M364(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,363,x0)         \
+    m(d,362,x1) m(d,361,x2) m(d,360,x3) m(d,359,x4) m(d,358,x5) m(d,357,x6)    \
+    m(d,356,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M356(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M365(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,364,x0)         \
+    m(d,363,x1) m(d,362,x2) m(d,361,x3) m(d,360,x4) m(d,359,x5) m(d,358,x6)    \
+    m(d,357,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M357(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M366(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,365,x0)         \
+    m(d,364,x1) m(d,363,x2) m(d,362,x3) m(d,361,x4) m(d,360,x5) m(d,359,x6)    \
+    m(d,358,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M358(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M367(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,366,x0)         \
+    m(d,365,x1) m(d,364,x2) m(d,363,x3) m(d,362,x4) m(d,361,x5) m(d,360,x6)    \
+    m(d,359,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M359(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M368(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,367,x0)         \
+    m(d,366,x1) m(d,365,x2) m(d,364,x3) m(d,363,x4) m(d,362,x5) m(d,361,x6)    \
+    m(d,360,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M360(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M369(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,368,x0)         \
+    m(d,367,x1) m(d,366,x2) m(d,365,x3) m(d,364,x4) m(d,363,x5) m(d,362,x6)    \
+    m(d,361,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M361(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M370(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,369,x0)         \
+    m(d,368,x1) m(d,367,x2) m(d,366,x3) m(d,365,x4) m(d,364,x5) m(d,363,x6)    \
+    m(d,362,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M362(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M371(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,370,x0)         \
+    m(d,369,x1) m(d,368,x2) m(d,367,x3) m(d,366,x4) m(d,365,x5) m(d,364,x6)    \
+    m(d,363,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M363(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M372(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,371,x0)         \
+    m(d,370,x1) m(d,369,x2) m(d,368,x3) m(d,367,x4) m(d,366,x5) m(d,365,x6)    \
+    m(d,364,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M364(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M373(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,372,x0)         \
+    m(d,371,x1) m(d,370,x2) m(d,369,x3) m(d,368,x4) m(d,367,x5) m(d,366,x6)    \
+    m(d,365,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M365(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M374(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,373,x0)         \
+    m(d,372,x1) m(d,371,x2) m(d,370,x3) m(d,369,x4) m(d,368,x5) m(d,367,x6)    \
+    m(d,366,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M366(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M375(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,374,x0)         \
+    m(d,373,x1) m(d,372,x2) m(d,371,x3) m(d,370,x4) m(d,369,x5) m(d,368,x6)    \
+    m(d,367,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M367(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M376(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,375,x0)         \
+    m(d,374,x1) m(d,373,x2) m(d,372,x3) m(d,371,x4) m(d,370,x5) m(d,369,x6)    \
+    m(d,368,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M368(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M377(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,376,x0)         \
+    m(d,375,x1) m(d,374,x2) m(d,373,x3) m(d,372,x4) m(d,371,x5) m(d,370,x6)    \
+    m(d,369,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M369(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M378(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,377,x0)         \
+    m(d,376,x1) m(d,375,x2) m(d,374,x3) m(d,373,x4) m(d,372,x5) m(d,371,x6)    \
+    m(d,370,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M370(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M379(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,378,x0)         \
+    m(d,377,x1) m(d,376,x2) m(d,375,x3) m(d,374,x4) m(d,373,x5) m(d,372,x6)    \
+    m(d,371,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M371(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M380(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,379,x0)         \
+    m(d,378,x1) m(d,377,x2) m(d,376,x3) m(d,375,x4) m(d,374,x5) m(d,373,x6)    \
+    m(d,372,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M372(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M381(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,380,x0)         \
+    m(d,379,x1) m(d,378,x2) m(d,377,x3) m(d,376,x4) m(d,375,x5) m(d,374,x6)    \
+    m(d,373,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M373(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M382(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,381,x0)         \
+    m(d,380,x1) m(d,379,x2) m(d,378,x3) m(d,377,x4) m(d,376,x5) m(d,375,x6)    \
+    m(d,374,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M374(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M383(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,382,x0)         \
+    m(d,381,x1) m(d,380,x2) m(d,379,x3) m(d,378,x4) m(d,377,x5) m(d,376,x6)    \
+    m(d,375,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M375(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M384(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,383,x0)         \
+    m(d,382,x1) m(d,381,x2) m(d,380,x3) m(d,379,x4) m(d,378,x5) m(d,377,x6)    \
+    m(d,376,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M376(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M385(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,384,x0)         \
+    m(d,383,x1) m(d,382,x2) m(d,381,x3) m(d,380,x4) m(d,379,x5) m(d,378,x6)    \
+    m(d,377,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M377(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M386(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,385,x0)         \
+    m(d,384,x1) m(d,383,x2) m(d,382,x3) m(d,381,x4) m(d,380,x5) m(d,379,x6)    \
+    m(d,378,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M378(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M387(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,386,x0)         \
+    m(d,385,x1) m(d,384,x2) m(d,383,x3) m(d,382,x4) m(d,381,x5) m(d,380,x6)    \
+    m(d,379,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M379(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M388(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,387,x0)         \
+    m(d,386,x1) m(d,385,x2) m(d,384,x3) m(d,383,x4) m(d,382,x5) m(d,381,x6)    \
+    m(d,380,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M380(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M389(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,388,x0)         \
+    m(d,387,x1) m(d,386,x2) m(d,385,x3) m(d,384,x4) m(d,383,x5) m(d,382,x6)    \
+    m(d,381,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M381(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M390(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,389,x0)         \
+    m(d,388,x1) m(d,387,x2) m(d,386,x3) m(d,385,x4) m(d,384,x5) m(d,383,x6)    \
+    m(d,382,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M382(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M391(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,390,x0)         \
+    m(d,389,x1) m(d,388,x2) m(d,387,x3) m(d,386,x4) m(d,385,x5) m(d,384,x6)    \
+    m(d,383,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M383(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M392(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,391,x0)         \
+    m(d,390,x1) m(d,389,x2) m(d,388,x3) m(d,387,x4) m(d,386,x5) m(d,385,x6)    \
+    m(d,384,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M384(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M393(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,392,x0)         \
+    m(d,391,x1) m(d,390,x2) m(d,389,x3) m(d,388,x4) m(d,387,x5) m(d,386,x6)    \
+    m(d,385,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M385(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M394(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,393,x0)         \
+    m(d,392,x1) m(d,391,x2) m(d,390,x3) m(d,389,x4) m(d,388,x5) m(d,387,x6)    \
+    m(d,386,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M386(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M395(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,394,x0)         \
+    m(d,393,x1) m(d,392,x2) m(d,391,x3) m(d,390,x4) m(d,389,x5) m(d,388,x6)    \
+    m(d,387,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M387(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M396(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,395,x0)         \
+    m(d,394,x1) m(d,393,x2) m(d,392,x3) m(d,391,x4) m(d,390,x5) m(d,389,x6)    \
+    m(d,388,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M388(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M397(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,396,x0)         \
+    m(d,395,x1) m(d,394,x2) m(d,393,x3) m(d,392,x4) m(d,391,x5) m(d,390,x6)    \
+    m(d,389,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M389(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M398(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,397,x0)         \
+    m(d,396,x1) m(d,395,x2) m(d,394,x3) m(d,393,x4) m(d,392,x5) m(d,391,x6)    \
+    m(d,390,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M390(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M399(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,398,x0)         \
+    m(d,397,x1) m(d,396,x2) m(d,395,x3) m(d,394,x4) m(d,393,x5) m(d,392,x6)    \
+    m(d,391,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M391(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M400(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,399,x0)         \
+    m(d,398,x1) m(d,397,x2) m(d,396,x3) m(d,395,x4) m(d,394,x5) m(d,393,x6)    \
+    m(d,392,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M392(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M401(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,400,x0)         \
+    m(d,399,x1) m(d,398,x2) m(d,397,x3) m(d,396,x4) m(d,395,x5) m(d,394,x6)    \
+    m(d,393,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M393(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M402(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,401,x0)         \
+    m(d,400,x1) m(d,399,x2) m(d,398,x3) m(d,397,x4) m(d,396,x5) m(d,395,x6)    \
+    m(d,394,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M394(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M403(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,402,x0)         \
+    m(d,401,x1) m(d,400,x2) m(d,399,x3) m(d,398,x4) m(d,397,x5) m(d,396,x6)    \
+    m(d,395,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M395(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M404(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,403,x0)         \
+    m(d,402,x1) m(d,401,x2) m(d,400,x3) m(d,399,x4) m(d,398,x5) m(d,397,x6)    \
+    m(d,396,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M396(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M405(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,404,x0)         \
+    m(d,403,x1) m(d,402,x2) m(d,401,x3) m(d,400,x4) m(d,399,x5) m(d,398,x6)    \
+    m(d,397,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M397(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M406(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,405,x0)         \
+    m(d,404,x1) m(d,403,x2) m(d,402,x3) m(d,401,x4) m(d,400,x5) m(d,399,x6)    \
+    m(d,398,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M398(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M407(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,406,x0)         \
+    m(d,405,x1) m(d,404,x2) m(d,403,x3) m(d,402,x4) m(d,401,x5) m(d,400,x6)    \
+    m(d,399,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M399(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M408(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,407,x0)         \
+    m(d,406,x1) m(d,405,x2) m(d,404,x3) m(d,403,x4) m(d,402,x5) m(d,401,x6)    \
+    m(d,400,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M400(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M409(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,408,x0)         \
+    m(d,407,x1) m(d,406,x2) m(d,405,x3) m(d,404,x4) m(d,403,x5) m(d,402,x6)    \
+    m(d,401,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M401(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M410(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,409,x0)         \
+    m(d,408,x1) m(d,407,x2) m(d,406,x3) m(d,405,x4) m(d,404,x5) m(d,403,x6)    \
+    m(d,402,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M402(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M411(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,410,x0)         \
+    m(d,409,x1) m(d,408,x2) m(d,407,x3) m(d,406,x4) m(d,405,x5) m(d,404,x6)    \
+    m(d,403,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M403(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M412(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,411,x0)         \
+    m(d,410,x1) m(d,409,x2) m(d,408,x3) m(d,407,x4) m(d,406,x5) m(d,405,x6)    \
+    m(d,404,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M404(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M413(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,412,x0)         \
+    m(d,411,x1) m(d,410,x2) m(d,409,x3) m(d,408,x4) m(d,407,x5) m(d,406,x6)    \
+    m(d,405,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M405(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M414(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,413,x0)         \
+    m(d,412,x1) m(d,411,x2) m(d,410,x3) m(d,409,x4) m(d,408,x5) m(d,407,x6)    \
+    m(d,406,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M406(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M415(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,414,x0)         \
+    m(d,413,x1) m(d,412,x2) m(d,411,x3) m(d,410,x4) m(d,409,x5) m(d,408,x6)    \
+    m(d,407,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M407(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M416(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,415,x0)         \
+    m(d,414,x1) m(d,413,x2) m(d,412,x3) m(d,411,x4) m(d,410,x5) m(d,409,x6)    \
+    m(d,408,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M408(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M417(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,416,x0)         \
+    m(d,415,x1) m(d,414,x2) m(d,413,x3) m(d,412,x4) m(d,411,x5) m(d,410,x6)    \
+    m(d,409,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M409(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M418(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,417,x0)         \
+    m(d,416,x1) m(d,415,x2) m(d,414,x3) m(d,413,x4) m(d,412,x5) m(d,411,x6)    \
+    m(d,410,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M410(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M419(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,418,x0)         \
+    m(d,417,x1) m(d,416,x2) m(d,415,x3) m(d,414,x4) m(d,413,x5) m(d,412,x6)    \
+    m(d,411,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M411(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M420(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,419,x0)         \
+    m(d,418,x1) m(d,417,x2) m(d,416,x3) m(d,415,x4) m(d,414,x5) m(d,413,x6)    \
+    m(d,412,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M412(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M421(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,420,x0)         \
+    m(d,419,x1) m(d,418,x2) m(d,417,x3) m(d,416,x4) m(d,415,x5) m(d,414,x6)    \
+    m(d,413,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M413(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M422(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,421,x0)         \
+    m(d,420,x1) m(d,419,x2) m(d,418,x3) m(d,417,x4) m(d,416,x5) m(d,415,x6)    \
+    m(d,414,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M414(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M423(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,422,x0)         \
+    m(d,421,x1) m(d,420,x2) m(d,419,x3) m(d,418,x4) m(d,417,x5) m(d,416,x6)    \
+    m(d,415,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M415(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M424(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,423,x0)         \
+    m(d,422,x1) m(d,421,x2) m(d,420,x3) m(d,419,x4) m(d,418,x5) m(d,417,x6)    \
+    m(d,416,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M416(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M425(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,424,x0)         \
+    m(d,423,x1) m(d,422,x2) m(d,421,x3) m(d,420,x4) m(d,419,x5) m(d,418,x6)    \
+    m(d,417,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M417(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M426(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,425,x0)         \
+    m(d,424,x1) m(d,423,x2) m(d,422,x3) m(d,421,x4) m(d,420,x5) m(d,419,x6)    \
+    m(d,418,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M418(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M427(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,426,x0)         \
+    m(d,425,x1) m(d,424,x2) m(d,423,x3) m(d,422,x4) m(d,421,x5) m(d,420,x6)    \
+    m(d,419,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M419(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M428(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,427,x0)         \
+    m(d,426,x1) m(d,425,x2) m(d,424,x3) m(d,423,x4) m(d,422,x5) m(d,421,x6)    \
+    m(d,420,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M420(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M429(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,428,x0)         \
+    m(d,427,x1) m(d,426,x2) m(d,425,x3) m(d,424,x4) m(d,423,x5) m(d,422,x6)    \
+    m(d,421,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M421(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M430(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,429,x0)         \
+    m(d,428,x1) m(d,427,x2) m(d,426,x3) m(d,425,x4) m(d,424,x5) m(d,423,x6)    \
+    m(d,422,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M422(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M431(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,430,x0)         \
+    m(d,429,x1) m(d,428,x2) m(d,427,x3) m(d,426,x4) m(d,425,x5) m(d,424,x6)    \
+    m(d,423,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M423(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M432(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,431,x0)         \
+    m(d,430,x1) m(d,429,x2) m(d,428,x3) m(d,427,x4) m(d,426,x5) m(d,425,x6)    \
+    m(d,424,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M424(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M433(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,432,x0)         \
+    m(d,431,x1) m(d,430,x2) m(d,429,x3) m(d,428,x4) m(d,427,x5) m(d,426,x6)    \
+    m(d,425,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M425(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M434(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,433,x0)         \
+    m(d,432,x1) m(d,431,x2) m(d,430,x3) m(d,429,x4) m(d,428,x5) m(d,427,x6)    \
+    m(d,426,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M426(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M435(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,434,x0)         \
+    m(d,433,x1) m(d,432,x2) m(d,431,x3) m(d,430,x4) m(d,429,x5) m(d,428,x6)    \
+    m(d,427,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M427(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M436(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,435,x0)         \
+    m(d,434,x1) m(d,433,x2) m(d,432,x3) m(d,431,x4) m(d,430,x5) m(d,429,x6)    \
+    m(d,428,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M428(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M437(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,436,x0)         \
+    m(d,435,x1) m(d,434,x2) m(d,433,x3) m(d,432,x4) m(d,431,x5) m(d,430,x6)    \
+    m(d,429,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M429(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M438(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,437,x0)         \
+    m(d,436,x1) m(d,435,x2) m(d,434,x3) m(d,433,x4) m(d,432,x5) m(d,431,x6)    \
+    m(d,430,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M430(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M439(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,438,x0)         \
+    m(d,437,x1) m(d,436,x2) m(d,435,x3) m(d,434,x4) m(d,433,x5) m(d,432,x6)    \
+    m(d,431,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M431(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M440(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,439,x0)         \
+    m(d,438,x1) m(d,437,x2) m(d,436,x3) m(d,435,x4) m(d,434,x5) m(d,433,x6)    \
+    m(d,432,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M432(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M441(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,440,x0)         \
+    m(d,439,x1) m(d,438,x2) m(d,437,x3) m(d,436,x4) m(d,435,x5) m(d,434,x6)    \
+    m(d,433,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M433(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M442(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,441,x0)         \
+    m(d,440,x1) m(d,439,x2) m(d,438,x3) m(d,437,x4) m(d,436,x5) m(d,435,x6)    \
+    m(d,434,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M434(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M443(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,442,x0)         \
+    m(d,441,x1) m(d,440,x2) m(d,439,x3) m(d,438,x4) m(d,437,x5) m(d,436,x6)    \
+    m(d,435,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M435(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M444(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,443,x0)         \
+    m(d,442,x1) m(d,441,x2) m(d,440,x3) m(d,439,x4) m(d,438,x5) m(d,437,x6)    \
+    m(d,436,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M436(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M445(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,444,x0)         \
+    m(d,443,x1) m(d,442,x2) m(d,441,x3) m(d,440,x4) m(d,439,x5) m(d,438,x6)    \
+    m(d,437,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M437(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M446(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,445,x0)         \
+    m(d,444,x1) m(d,443,x2) m(d,442,x3) m(d,441,x4) m(d,440,x5) m(d,439,x6)    \
+    m(d,438,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M438(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M447(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,446,x0)         \
+    m(d,445,x1) m(d,444,x2) m(d,443,x3) m(d,442,x4) m(d,441,x5) m(d,440,x6)    \
+    m(d,439,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M439(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M448(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,447,x0)         \
+    m(d,446,x1) m(d,445,x2) m(d,444,x3) m(d,443,x4) m(d,442,x5) m(d,441,x6)    \
+    m(d,440,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M440(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M449(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,448,x0)         \
+    m(d,447,x1) m(d,446,x2) m(d,445,x3) m(d,444,x4) m(d,443,x5) m(d,442,x6)    \
+    m(d,441,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M441(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M450(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,449,x0)         \
+    m(d,448,x1) m(d,447,x2) m(d,446,x3) m(d,445,x4) m(d,444,x5) m(d,443,x6)    \
+    m(d,442,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M442(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M451(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,450,x0)         \
+    m(d,449,x1) m(d,448,x2) m(d,447,x3) m(d,446,x4) m(d,445,x5) m(d,444,x6)    \
+    m(d,443,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M443(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M452(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,451,x0)         \
+    m(d,450,x1) m(d,449,x2) m(d,448,x3) m(d,447,x4) m(d,446,x5) m(d,445,x6)    \
+    m(d,444,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M444(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M453(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,452,x0)         \
+    m(d,451,x1) m(d,450,x2) m(d,449,x3) m(d,448,x4) m(d,447,x5) m(d,446,x6)    \
+    m(d,445,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M445(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M454(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,453,x0)         \
+    m(d,452,x1) m(d,451,x2) m(d,450,x3) m(d,449,x4) m(d,448,x5) m(d,447,x6)    \
+    m(d,446,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M446(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M455(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,454,x0)         \
+    m(d,453,x1) m(d,452,x2) m(d,451,x3) m(d,450,x4) m(d,449,x5) m(d,448,x6)    \
+    m(d,447,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M447(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M456(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,455,x0)         \
+    m(d,454,x1) m(d,453,x2) m(d,452,x3) m(d,451,x4) m(d,450,x5) m(d,449,x6)    \
+    m(d,448,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M448(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M457(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,456,x0)         \
+    m(d,455,x1) m(d,454,x2) m(d,453,x3) m(d,452,x4) m(d,451,x5) m(d,450,x6)    \
+    m(d,449,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M449(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M458(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,457,x0)         \
+    m(d,456,x1) m(d,455,x2) m(d,454,x3) m(d,453,x4) m(d,452,x5) m(d,451,x6)    \
+    m(d,450,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M450(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M459(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,458,x0)         \
+    m(d,457,x1) m(d,456,x2) m(d,455,x3) m(d,454,x4) m(d,453,x5) m(d,452,x6)    \
+    m(d,451,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M451(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M460(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,459,x0)         \
+    m(d,458,x1) m(d,457,x2) m(d,456,x3) m(d,455,x4) m(d,454,x5) m(d,453,x6)    \
+    m(d,452,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M452(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M461(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,460,x0)         \
+    m(d,459,x1) m(d,458,x2) m(d,457,x3) m(d,456,x4) m(d,455,x5) m(d,454,x6)    \
+    m(d,453,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M453(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M462(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,461,x0)         \
+    m(d,460,x1) m(d,459,x2) m(d,458,x3) m(d,457,x4) m(d,456,x5) m(d,455,x6)    \
+    m(d,454,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M454(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M463(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,462,x0)         \
+    m(d,461,x1) m(d,460,x2) m(d,459,x3) m(d,458,x4) m(d,457,x5) m(d,456,x6)    \
+    m(d,455,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M455(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M464(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,463,x0)         \
+    m(d,462,x1) m(d,461,x2) m(d,460,x3) m(d,459,x4) m(d,458,x5) m(d,457,x6)    \
+    m(d,456,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M456(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M465(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,464,x0)         \
+    m(d,463,x1) m(d,462,x2) m(d,461,x3) m(d,460,x4) m(d,459,x5) m(d,458,x6)    \
+    m(d,457,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M457(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M466(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,465,x0)         \
+    m(d,464,x1) m(d,463,x2) m(d,462,x3) m(d,461,x4) m(d,460,x5) m(d,459,x6)    \
+    m(d,458,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M458(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M467(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,466,x0)         \
+    m(d,465,x1) m(d,464,x2) m(d,463,x3) m(d,462,x4) m(d,461,x5) m(d,460,x6)    \
+    m(d,459,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M459(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M468(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,467,x0)         \
+    m(d,466,x1) m(d,465,x2) m(d,464,x3) m(d,463,x4) m(d,462,x5) m(d,461,x6)    \
+    m(d,460,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M460(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M469(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,468,x0)         \
+    m(d,467,x1) m(d,466,x2) m(d,465,x3) m(d,464,x4) m(d,463,x5) m(d,462,x6)    \
+    m(d,461,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M461(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M470(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,469,x0)         \
+    m(d,468,x1) m(d,467,x2) m(d,466,x3) m(d,465,x4) m(d,464,x5) m(d,463,x6)    \
+    m(d,462,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M462(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M471(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,470,x0)         \
+    m(d,469,x1) m(d,468,x2) m(d,467,x3) m(d,466,x4) m(d,465,x5) m(d,464,x6)    \
+    m(d,463,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M463(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M472(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,471,x0)         \
+    m(d,470,x1) m(d,469,x2) m(d,468,x3) m(d,467,x4) m(d,466,x5) m(d,465,x6)    \
+    m(d,464,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M464(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M473(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,472,x0)         \
+    m(d,471,x1) m(d,470,x2) m(d,469,x3) m(d,468,x4) m(d,467,x5) m(d,466,x6)    \
+    m(d,465,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M465(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M474(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,473,x0)         \
+    m(d,472,x1) m(d,471,x2) m(d,470,x3) m(d,469,x4) m(d,468,x5) m(d,467,x6)    \
+    m(d,466,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M466(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M475(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,474,x0)         \
+    m(d,473,x1) m(d,472,x2) m(d,471,x3) m(d,470,x4) m(d,469,x5) m(d,468,x6)    \
+    m(d,467,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M467(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M476(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,475,x0)         \
+    m(d,474,x1) m(d,473,x2) m(d,472,x3) m(d,471,x4) m(d,470,x5) m(d,469,x6)    \
+    m(d,468,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M468(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M477(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,476,x0)         \
+    m(d,475,x1) m(d,474,x2) m(d,473,x3) m(d,472,x4) m(d,471,x5) m(d,470,x6)    \
+    m(d,469,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M469(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M478(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,477,x0)         \
+    m(d,476,x1) m(d,475,x2) m(d,474,x3) m(d,473,x4) m(d,472,x5) m(d,471,x6)    \
+    m(d,470,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M470(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M479(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,478,x0)         \
+    m(d,477,x1) m(d,476,x2) m(d,475,x3) m(d,474,x4) m(d,473,x5) m(d,472,x6)    \
+    m(d,471,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M471(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M480(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,479,x0)         \
+    m(d,478,x1) m(d,477,x2) m(d,476,x3) m(d,475,x4) m(d,474,x5) m(d,473,x6)    \
+    m(d,472,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M472(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M481(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,480,x0)         \
+    m(d,479,x1) m(d,478,x2) m(d,477,x3) m(d,476,x4) m(d,475,x5) m(d,474,x6)    \
+    m(d,473,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M473(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M482(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,481,x0)         \
+    m(d,480,x1) m(d,479,x2) m(d,478,x3) m(d,477,x4) m(d,476,x5) m(d,475,x6)    \
+    m(d,474,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M474(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M483(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,482,x0)         \
+    m(d,481,x1) m(d,480,x2) m(d,479,x3) m(d,478,x4) m(d,477,x5) m(d,476,x6)    \
+    m(d,475,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M475(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M484(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,483,x0)         \
+    m(d,482,x1) m(d,481,x2) m(d,480,x3) m(d,479,x4) m(d,478,x5) m(d,477,x6)    \
+    m(d,476,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M476(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M485(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,484,x0)         \
+    m(d,483,x1) m(d,482,x2) m(d,481,x3) m(d,480,x4) m(d,479,x5) m(d,478,x6)    \
+    m(d,477,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M477(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M486(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,485,x0)         \
+    m(d,484,x1) m(d,483,x2) m(d,482,x3) m(d,481,x4) m(d,480,x5) m(d,479,x6)    \
+    m(d,478,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M478(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M487(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,486,x0)         \
+    m(d,485,x1) m(d,484,x2) m(d,483,x3) m(d,482,x4) m(d,481,x5) m(d,480,x6)    \
+    m(d,479,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M479(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M488(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,487,x0)         \
+    m(d,486,x1) m(d,485,x2) m(d,484,x3) m(d,483,x4) m(d,482,x5) m(d,481,x6)    \
+    m(d,480,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M480(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M489(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,488,x0)         \
+    m(d,487,x1) m(d,486,x2) m(d,485,x3) m(d,484,x4) m(d,483,x5) m(d,482,x6)    \
+    m(d,481,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M481(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M490(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,489,x0)         \
+    m(d,488,x1) m(d,487,x2) m(d,486,x3) m(d,485,x4) m(d,484,x5) m(d,483,x6)    \
+    m(d,482,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M482(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M491(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,490,x0)         \
+    m(d,489,x1) m(d,488,x2) m(d,487,x3) m(d,486,x4) m(d,485,x5) m(d,484,x6)    \
+    m(d,483,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M483(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M492(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,491,x0)         \
+    m(d,490,x1) m(d,489,x2) m(d,488,x3) m(d,487,x4) m(d,486,x5) m(d,485,x6)    \
+    m(d,484,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M484(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M493(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,492,x0)         \
+    m(d,491,x1) m(d,490,x2) m(d,489,x3) m(d,488,x4) m(d,487,x5) m(d,486,x6)    \
+    m(d,485,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M485(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M494(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,493,x0)         \
+    m(d,492,x1) m(d,491,x2) m(d,490,x3) m(d,489,x4) m(d,488,x5) m(d,487,x6)    \
+    m(d,486,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M486(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M495(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,494,x0)         \
+    m(d,493,x1) m(d,492,x2) m(d,491,x3) m(d,490,x4) m(d,489,x5) m(d,488,x6)    \
+    m(d,487,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M487(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M496(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,495,x0)         \
+    m(d,494,x1) m(d,493,x2) m(d,492,x3) m(d,491,x4) m(d,490,x5) m(d,489,x6)    \
+    m(d,488,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M488(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M497(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,496,x0)         \
+    m(d,495,x1) m(d,494,x2) m(d,493,x3) m(d,492,x4) m(d,491,x5) m(d,490,x6)    \
+    m(d,489,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M489(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M498(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,497,x0)         \
+    m(d,496,x1) m(d,495,x2) m(d,494,x3) m(d,493,x4) m(d,492,x5) m(d,491,x6)    \
+    m(d,490,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M490(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M499(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,498,x0)         \
+    m(d,497,x1) m(d,496,x2) m(d,495,x3) m(d,494,x4) m(d,493,x5) m(d,492,x6)    \
+    m(d,491,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M491(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M500(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,499,x0)         \
+    m(d,498,x1) m(d,497,x2) m(d,496,x3) m(d,495,x4) m(d,494,x5) m(d,493,x6)    \
+    m(d,492,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M492(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M501(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,500,x0)         \
+    m(d,499,x1) m(d,498,x2) m(d,497,x3) m(d,496,x4) m(d,495,x5) m(d,494,x6)    \
+    m(d,493,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M493(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M502(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,501,x0)         \
+    m(d,500,x1) m(d,499,x2) m(d,498,x3) m(d,497,x4) m(d,496,x5) m(d,495,x6)    \
+    m(d,494,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M494(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M503(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,502,x0)         \
+    m(d,501,x1) m(d,500,x2) m(d,499,x3) m(d,498,x4) m(d,497,x5) m(d,496,x6)    \
+    m(d,495,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M495(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M504(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,503,x0)         \
+    m(d,502,x1) m(d,501,x2) m(d,500,x3) m(d,499,x4) m(d,498,x5) m(d,497,x6)    \
+    m(d,496,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M496(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M505(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,504,x0)         \
+    m(d,503,x1) m(d,502,x2) m(d,501,x3) m(d,500,x4) m(d,499,x5) m(d,498,x6)    \
+    m(d,497,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M497(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M506(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,505,x0)         \
+    m(d,504,x1) m(d,503,x2) m(d,502,x3) m(d,501,x4) m(d,500,x5) m(d,499,x6)    \
+    m(d,498,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M498(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M507(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,506,x0)         \
+    m(d,505,x1) m(d,504,x2) m(d,503,x3) m(d,502,x4) m(d,501,x5) m(d,500,x6)    \
+    m(d,499,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M499(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M508(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,507,x0)         \
+    m(d,506,x1) m(d,505,x2) m(d,504,x3) m(d,503,x4) m(d,502,x5) m(d,501,x6)    \
+    m(d,500,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M500(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M509(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,508,x0)         \
+    m(d,507,x1) m(d,506,x2) m(d,505,x3) m(d,504,x4) m(d,503,x5) m(d,502,x6)    \
+    m(d,501,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M501(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M510(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,509,x0)         \
+    m(d,508,x1) m(d,507,x2) m(d,506,x3) m(d,505,x4) m(d,504,x5) m(d,503,x6)    \
+    m(d,502,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M502(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M511(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,510,x0)         \
+    m(d,509,x1) m(d,508,x2) m(d,507,x3) m(d,506,x4) m(d,505,x5) m(d,504,x6)    \
+    m(d,503,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M503(m,d,__VA_ARGS__))
+#define BETTER_ENUMS_M512(m,d,x0,x1,x2,x3,x4,x5,x6,x7,...) m(d,511,x0)         \
+    m(d,510,x1) m(d,509,x2) m(d,508,x3) m(d,507,x4) m(d,506,x5) m(d,505,x6)    \
+    m(d,504,x7) BETTER_ENUMS_ID(BETTER_ENUMS_M504(m,d,__VA_ARGS__))
+
+#define BETTER_ENUMS_PP_COUNT_IMPL(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10,    \
+    _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, \
+    _26, _27, _28, _29, _30, _31, _32, _33, _34, _35, _36, _37, _38, _39, _40, \
+    _41, _42, _43, _44, _45, _46, _47, _48, _49, _50, _51, _52, _53, _54, _55, \
+    _56, _57, _58, _59, _60, _61, _62, _63, _64, _65, _66, _67, _68, _69, _70, \
+    _71, _72, _73, _74, _75, _76, _77, _78, _79, _80, _81, _82, _83, _84, _85, \
+    _86, _87, _88, _89, _90, _91, _92, _93, _94, _95, _96, _97, _98, _99, _100,\
+    _101, _102, _103, _104, _105, _106, _107, _108, _109, _110, _111, _112,    \
+    _113, _114, _115, _116, _117, _118, _119, _120, _121, _122, _123, _124,    \
+    _125, _126, _127, _128, _129, _130, _131, _132, _133, _134, _135, _136,    \
+    _137, _138, _139, _140, _141, _142, _143, _144, _145, _146, _147, _148,    \
+    _149, _150, _151, _152, _153, _154, _155, _156, _157, _158, _159, _160,    \
+    _161, _162, _163, _164, _165, _166, _167, _168, _169, _170, _171, _172,    \
+    _173, _174, _175, _176, _177, _178, _179, _180, _181, _182, _183, _184,    \
+    _185, _186, _187, _188, _189, _190, _191, _192, _193, _194, _195, _196,    \
+    _197, _198, _199, _200, _201, _202, _203, _204, _205, _206, _207, _208,    \
+    _209, _210, _211, _212, _213, _214, _215, _216, _217, _218, _219, _220,    \
+    _221, _222, _223, _224, _225, _226, _227, _228, _229, _230, _231, _232,    \
+    _233, _234, _235, _236, _237, _238, _239, _240, _241, _242, _243, _244,    \
+    _245, _246, _247, _248, _249, _250, _251, _252, _253, _254, _255, _256,    \
+    _257, _258, _259, _260, _261, _262, _263, _264, _265, _266, _267, _268,    \
+    _269, _270, _271, _272, _273, _274, _275, _276, _277, _278, _279, _280,    \
+    _281, _282, _283, _284, _285, _286, _287, _288, _289, _290, _291, _292,    \
+    _293, _294, _295, _296, _297, _298, _299, _300, _301, _302, _303, _304,    \
+    _305, _306, _307, _308, _309, _310, _311, _312, _313, _314, _315, _316,    \
+    _317, _318, _319, _320, _321, _322, _323, _324, _325, _326, _327, _328,    \
+    _329, _330, _331, _332, _333, _334, _335, _336, _337, _338, _339, _340,    \
+    _341, _342, _343, _344, _345, _346, _347, _348, _349, _350, _351, _352,    \
+    _353, _354, _355, _356, _357, _358, _359, _360, _361, _362, _363, _364,    \
+    _365, _366, _367, _368, _369, _370, _371, _372, _373, _374, _375, _376,    \
+    _377, _378, _379, _380, _381, _382, _383, _384, _385, _386, _387, _388,    \
+    _389, _390, _391, _392, _393, _394, _395, _396, _397, _398, _399, _400,    \
+    _401, _402, _403, _404, _405, _406, _407, _408, _409, _410, _411, _412,    \
+    _413, _414, _415, _416, _417, _418, _419, _420, _421, _422, _423, _424,    \
+    _425, _426, _427, _428, _429, _430, _431, _432, _433, _434, _435, _436,    \
+    _437, _438, _439, _440, _441, _442, _443, _444, _445, _446, _447, _448,    \
+    _449, _450, _451, _452, _453, _454, _455, _456, _457, _458, _459, _460,    \
+    _461, _462, _463, _464, _465, _466, _467, _468, _469, _470, _471, _472,    \
+    _473, _474, _475, _476, _477, _478, _479, _480, _481, _482, _483, _484,    \
+    _485, _486, _487, _488, _489, _490, _491, _492, _493, _494, _495, _496,    \
+    _497, _498, _499, _500, _501, _502, _503, _504, _505, _506, _507, _508,    \
+    _509, _510, _511, _512, count, ...) count
+
+#define BETTER_ENUMS_PP_COUNT(...) \
+    BETTER_ENUMS_ID(BETTER_ENUMS_PP_COUNT_IMPL(__VA_ARGS__, 512, 511, 510, 509,\
+        508, 507, 506, 505, 504, 503, 502, 501, 500, 499, 498, 497, 496, 495,  \
+        494, 493, 492, 491, 490, 489, 488, 487, 486, 485, 484, 483, 482, 481,  \
+        480, 479, 478, 477, 476, 475, 474, 473, 472, 471, 470, 469, 468, 467,  \
+        466, 465, 464, 463, 462, 461, 460, 459, 458, 457, 456, 455, 454, 453,  \
+        452, 451, 450, 449, 448, 447, 446, 445, 444, 443, 442, 441, 440, 439,  \
+        438, 437, 436, 435, 434, 433, 432, 431, 430, 429, 428, 427, 426, 425,  \
+        424, 423, 422, 421, 420, 419, 418, 417, 416, 415, 414, 413, 412, 411,  \
+        410, 409, 408, 407, 406, 405, 404, 403, 402, 401, 400, 399, 398, 397,  \
+        396, 395, 394, 393, 392, 391, 390, 389, 388, 387, 386, 385, 384, 383,  \
+        382, 381, 380, 379, 378, 377, 376, 375, 374, 373, 372, 371, 370, 369,  \
+        368, 367, 366, 365, 364, 363, 362, 361, 360, 359, 358, 357, 356, 355,  \
+        354, 353, 352, 351, 350, 349, 348, 347, 346, 345, 344, 343, 342, 341,  \
+        340, 339, 338, 337, 336, 335, 334, 333, 332, 331, 330, 329, 328, 327,  \
+        326, 325, 324, 323, 322, 321, 320, 319, 318, 317, 316, 315, 314, 313,  \
+        312, 311, 310, 309, 308, 307, 306, 305, 304, 303, 302, 301, 300, 299,  \
+        298, 297, 296, 295, 294, 293, 292, 291, 290, 289, 288, 287, 286, 285,  \
+        284, 283, 282, 281, 280, 279, 278, 277, 276, 275, 274, 273, 272, 271,  \
+        270, 269, 268, 267, 266, 265, 264, 263, 262, 261, 260, 259, 258, 257,  \
+        256, 255, 254, 253, 252, 251, 250, 249, 248, 247, 246, 245, 244, 243,  \
+        242, 241, 240, 239, 238, 237, 236, 235, 234, 233, 232, 231, 230, 229,  \
+        228, 227, 226, 225, 224, 223, 222, 221, 220, 219, 218, 217, 216, 215,  \
+        214, 213, 212, 211, 210, 209, 208, 207, 206, 205, 204, 203, 202, 201,  \
+        200, 199, 198, 197, 196, 195, 194, 193, 192, 191, 190, 189, 188, 187,  \
+        186, 185, 184, 183, 182, 181, 180, 179, 178, 177, 176, 175, 174, 173,  \
+        172, 171, 170, 169, 168, 167, 166, 165, 164, 163, 162, 161, 160, 159,  \
+        158, 157, 156, 155, 154, 153, 152, 151, 150, 149, 148, 147, 146, 145,  \
+        144, 143, 142, 141, 140, 139, 138, 137, 136, 135, 134, 133, 132, 131,  \
+        130, 129, 128, 127, 126, 125, 124, 123, 122, 121, 120, 119, 118, 117,  \
+        116, 115, 114, 113, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103,  \
+        102, 101, 100, 99, 98, 97, 96, 95, 94, 93, 92, 91, 90, 89, 88, 87, 86, \
+        85, 84, 83, 82, 81, 80, 79, 78, 77, 76, 75, 74, 73, 72, 71, 70, 69, 68,\
+        67, 66, 65, 64, 63, 62, 61, 60, 59, 58, 57, 56, 55, 54, 53, 52, 51, 50,\
+        49, 48, 47, 46, 45, 44, 43, 42, 41, 40, 39, 38, 37, 36, 35, 34, 33, 32,\
+        31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14,\
+        13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+
+#define BETTER_ENUMS_ITERATE(X, f, l) X(f, l, 0) X(f, l, 1) X(f, l, 2)         \
+    X(f, l, 3) X(f, l, 4) X(f, l, 5) X(f, l, 6) X(f, l, 7) X(f, l, 8)          \
+    X(f, l, 9) X(f, l, 10) X(f, l, 11) X(f, l, 12) X(f, l, 13) X(f, l, 14)     \
+    X(f, l, 15) X(f, l, 16) X(f, l, 17) X(f, l, 18) X(f, l, 19) X(f, l, 20)    \
+    X(f, l, 21) X(f, l, 22) X(f, l, 23) X(f, l, 24) X(f, l, 25) X(f, l, 26)    \
+    X(f, l, 27) X(f, l, 28) X(f, l, 29) X(f, l, 30) X(f, l, 31)
+
+#endif // #ifndef BETTER_ENUMS_MACRO_FILE_H